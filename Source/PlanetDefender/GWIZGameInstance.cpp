@@ -5,7 +5,7 @@
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "GameFramework/GameMode.h"
-#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -19,6 +19,7 @@ UGWIZGameInstance::UGWIZGameInstance()
 {
     GlobalPoolingManager = nullptr;
     bPoolingSystemInitialized = false;
+    UsageSampleIntervalSeconds = 0.5f;
 }
 
 void UGWIZGameInstance::Init()
@@ -31,14 +32,16 @@ void UGWIZGameInstance::Init()
 
 void UGWIZGameInstance::Shutdown()
 {
-    // Save pooling system state before shutdown
+    // Save pooling system state before shutdown, including what was learned in the current level
     if (bPoolingSystemInitialized)
     {
+        FinishLevelUsage();
         SavePoolingSystemState();
     }
+    GetTimerManager().ClearTimer(UsageSampleTimerHandle);
     
-    // Cleanup global pooling manager
-    if (GlobalPoolingManager != nullptr)
+    // Cleanup global pooling manager (it may already have gone with its world)
+    if (IsValid(GlobalPoolingManager))
     {
         GlobalPoolingManager->ClearAllPools();
         GlobalPoolingManager = nullptr;
@@ -64,35 +67,14 @@ void UGWIZGameInstance::InitializePoolingSystem()
         return;
     }
     
-    // Try to find existing pooling manager in the world
-    if (GetWorld())
-    {
-        TArray<AActor*> FoundActors;
-        UGameplayStatics::GetAllActorsOfClass(GetWorld(), AGWIZPoolingManager::StaticClass(), FoundActors);
-        
-        if (FoundActors.Num() > 0)
-        {
-            GlobalPoolingManager = Cast<AGWIZPoolingManager>(FoundActors[0]);
-        }
-    }
-    
-    // Create new pooling manager if none exists
-    if (GlobalPoolingManager == nullptr && GetWorld())
-    {
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-        SpawnParams.bDeferConstruction = false;
-        
-        GlobalPoolingManager = GetWorld()->SpawnActor<AGWIZPoolingManager>(
-            AGWIZPoolingManager::StaticClass(), 
-            FVector::ZeroVector, 
-            FRotator::ZeroRotator, 
-            SpawnParams
-        );
-    }
+    // The world's subsystem finds the manager placed in the level or spawns one
+    GlobalPoolingManager = AGWIZPoolingManager::GetPoolingManager(GetWorld());
     
     if (GlobalPoolingManager != nullptr)
     {
+        // Restore configurations and learned usage saved by the previous session
+        DeserializePoolState();
+        
         // Load persistent pool configurations
         LoadPoolConfigurations();
         
@@ -170,10 +152,11 @@ void UGWIZGameInstance::PreWarmPoolsForLevel(const FString& LevelName)
     // Setup pools for the specified level
     SetupPoolsForLevel(LevelName);
     
-    // Pre-warm all pools
-    GlobalPoolingManager->PreWarmAllPools();
+    // Queue pre-warming so it is spread across frames instead of hitching the level transition, sized from what
+    // this level used last time where it has been learned
+    QueueLearnedPreWarm(LevelName);
     
-    UE_LOG(LogTemp, Log, TEXT("GWIZGameInstance::PreWarmPoolsForLevel - Pools pre-warmed for level: %s"), *LevelName);
+    UE_LOG(LogTemp, Log, TEXT("GWIZGameInstance::PreWarmPoolsForLevel - Pools queued for pre-warming for level: %s"), *LevelName);
 }
 
 void UGWIZGameInstance::CleanupUnusedPoolsForLevel(const FString& LevelName)
@@ -208,14 +191,24 @@ void UGWIZGameInstance::HandleLevelTransition(UWorld* OldWorld, UWorld* NewWorld
     if (OldWorld != nullptr)
     {
         FString OldLevelName = OldWorld->GetMapName();
+        FinishLevelUsage();
         CleanupPoolsForLevel(OldLevelName);
     }
     
     // Setup pools for new world
     if (NewWorld != nullptr)
     {
+        // Managers belong to their world, so the new world brings a new manager; give it the persistent configurations
+        AGWIZPoolingManager* NewWorldManager = AGWIZPoolingManager::GetPoolingManager(NewWorld);
+        if (NewWorldManager != nullptr && NewWorldManager != GlobalPoolingManager)
+        {
+            GlobalPoolingManager = NewWorldManager;
+            LoadPoolConfigurations();
+        }
+        
         FString NewLevelName = NewWorld->GetMapName();
         SetupPoolsForLevel(NewLevelName);
+        BeginLevelUsage(NewLevelName);
         
         // Pre-warm pools for the new level
         PreWarmPoolsForLevel(NewLevelName);
@@ -305,6 +298,111 @@ void UGWIZGameInstance::CleanupPoolsForLevel(const FString& LevelName)
     // for other levels. We just clean up unused objects.
 }
 
+FGWIZLevelUsageProfiles UGWIZGameInstance::GetLevelUsageProfiles(const FString& LevelName) const
+{
+    FScopeLock Lock(&PoolingMutex);
+    
+    const FGWIZLevelUsageProfiles* Profiles = LevelUsageProfiles.Find(LevelName);
+    return Profiles != nullptr ? *Profiles : FGWIZLevelUsageProfiles();
+}
+
+void UGWIZGameInstance::BeginLevelUsage(const FString& LevelName)
+{
+    CurrentLevelName = LevelName;
+    CurrentLevelUsage.Empty();
+    
+    // The game instance timer manager survives level transitions, so one looping timer covers every level
+    GetTimerManager().SetTimer(UsageSampleTimerHandle, this, &UGWIZGameInstance::SampleLevelUsage, UsageSampleIntervalSeconds, true);
+}
+
+void UGWIZGameInstance::SampleLevelUsage()
+{
+    FScopeLock Lock(&PoolingMutex);
+    
+    if (!IsValid(GlobalPoolingManager) || CurrentLevelName.IsEmpty())
+    {
+        return;
+    }
+    
+    // Sampling on a timer weights each count by how long it lasted, which is what p95 should mean here
+    for (UGWIZObjectPool* Pool : GlobalPoolingManager->GetAllPools())
+    {
+        if (Pool != nullptr && Pool->GetPooledObjectClass() != nullptr)
+        {
+            CurrentLevelUsage.FindOrAdd(Pool->GetPooledObjectClass()->GetName()).Add(Pool->GetObjectsInUse());
+        }
+    }
+}
+
+void UGWIZGameInstance::FinishLevelUsage()
+{
+    if (CurrentLevelName.IsEmpty())
+    {
+        return;
+    }
+    
+    FGWIZLevelUsageProfiles& Profiles = LevelUsageProfiles.FindOrAdd(CurrentLevelName);
+    for (const auto& UsagePair : CurrentLevelUsage)
+    {
+        const FGWIZConcurrencyHistogram& Usage = UsagePair.Value;
+        if (Usage.SampleCount == 0)
+        {
+            continue;
+        }
+        
+        FGWIZPoolUsageProfile& Profile = Profiles.Profiles.FindOrAdd(UsagePair.Key);
+        Profile.Merge(Usage.Peak, Usage.GetPercentile(0.95));
+        
+        UE_LOG(LogTemp, Log, TEXT("GWIZGameInstance::FinishLevelUsage - %s in %s: peak %d, p95 %d over %u samples (learned peak %d, p95 %d)"),
+               *UsagePair.Key, *CurrentLevelName, Usage.Peak, Usage.GetPercentile(0.95), Usage.SampleCount,
+               Profile.PeakConcurrentUsage, Profile.P95ConcurrentUsage);
+    }
+    
+    CurrentLevelName.Empty();
+    CurrentLevelUsage.Empty();
+}
+
+void UGWIZGameInstance::QueueLearnedPreWarm(const FString& LevelName)
+{
+    // Learned pools are created first, so every pool the level used is queued below
+    const FGWIZLevelUsageProfiles* Profiles = LevelUsageProfiles.Find(LevelName);
+    if (Profiles != nullptr)
+    {
+        for (const auto& ProfilePair : Profiles->Profiles)
+        {
+            if (UClass* ObjectClass = FindObject<UClass>(nullptr, *ProfilePair.Key))
+            {
+                GlobalPoolingManager->GetPool(ObjectClass);
+            }
+        }
+    }
+    
+    // The learned size only drives this load's pre-warm; Config is left alone, so it is never saved as a hand-set
+    // configuration, never carries over to another level and never raises the eviction floor
+    for (UGWIZObjectPool* Pool : GlobalPoolingManager->GetAllPools())
+    {
+        int32 PreWarmCount = Pool->Config.InitialPoolSize;
+        
+        const FGWIZPoolUsageProfile* Profile = Profiles != nullptr ? Profiles->Profiles.Find(Pool->GetPooledObjectClass()->GetName()) : nullptr;
+        if (Profile != nullptr)
+        {
+            // Protected pools (missiles, interceptors) must not miss at the peak; everything else warms to p95
+            // and leaves the rest to adaptive sizing
+            const bool bProtected = Pool->Config.Priority >= GlobalPoolingManager->EvictionProtectedPriority;
+            const int32 LearnedSize = bProtected ? Profile->PeakConcurrentUsage : Profile->P95ConcurrentUsage;
+            PreWarmCount = FMath::Clamp(LearnedSize, Pool->Config.MinPoolSize, Pool->Config.MaxPoolSize);
+            
+            UE_LOG(LogTemp, Log, TEXT("GWIZGameInstance::QueueLearnedPreWarm - %s in %s: pre-warming %d (learned from %d sessions)"),
+                   *Pool->GetPooledObjectClass()->GetName(), *LevelName, PreWarmCount, Profile->SessionCount);
+        }
+        
+        if (PreWarmCount > 0)
+        {
+            GlobalPoolingManager->QueuePreWarm(Pool->GetPooledObjectClass(), PreWarmCount);
+        }
+    }
+}
+
 void UGWIZGameInstance::SerializePoolState()
 {
     // Create JSON object for pool state
@@ -322,7 +420,7 @@ void UGWIZGameInstance::SerializePoolState()
         ConfigObject->SetNumberField(TEXT("MaxPoolSize"), Config.MaxPoolSize);
         ConfigObject->SetNumberField(TEXT("InitialPoolSize"), Config.InitialPoolSize);
         ConfigObject->SetNumberField(TEXT("Priority"), static_cast<double>(Config.Priority));
-        ConfigObject->SetStringField(TEXT("Category"), Config.Category);
+        ConfigObject->SetStringField(TEXT("Category"), Config.Category.ToString());
         
         ConfigsObject->SetObjectField(ClassName, ConfigObject);
     }
@@ -346,7 +444,7 @@ void UGWIZGameInstance::SerializePoolState()
             ConfigObject->SetNumberField(TEXT("MaxPoolSize"), Config.MaxPoolSize);
             ConfigObject->SetNumberField(TEXT("InitialPoolSize"), Config.InitialPoolSize);
             ConfigObject->SetNumberField(TEXT("Priority"), static_cast<double>(Config.Priority));
-            ConfigObject->SetStringField(TEXT("Category"), Config.Category);
+            ConfigObject->SetStringField(TEXT("Category"), Config.Category.ToString());
             
             LevelObject->SetObjectField(ClassName, ConfigObject);
         }
@@ -354,6 +452,26 @@ void UGWIZGameInstance::SerializePoolState()
     }
     RootObject->SetObjectField("LevelConfigs", LevelConfigsObject);
     
+    // Serialize learned usage profiles
+    TSharedPtr<FJsonObject> UsageProfilesObject = MakeShareable(new FJsonObject);
+    for (const auto& LevelPair : LevelUsageProfiles)
+    {
+        TSharedPtr<FJsonObject> LevelObject = MakeShareable(new FJsonObject);
+        for (const auto& ProfilePair : LevelPair.Value.Profiles)
+        {
+            const FGWIZPoolUsageProfile& Profile = ProfilePair.Value;
+            
+            TSharedPtr<FJsonObject> ProfileObject = MakeShareable(new FJsonObject);
+            ProfileObject->SetNumberField(TEXT("PeakConcurrentUsage"), Profile.PeakConcurrentUsage);
+            ProfileObject->SetNumberField(TEXT("P95ConcurrentUsage"), Profile.P95ConcurrentUsage);
+            ProfileObject->SetNumberField(TEXT("SessionCount"), Profile.SessionCount);
+            
+            LevelObject->SetObjectField(ProfilePair.Key, ProfileObject);
+        }
+        UsageProfilesObject->SetObjectField(LevelPair.Key, LevelObject);
+    }
+    RootObject->SetObjectField("UsageProfiles", UsageProfilesObject);
+    
     // Convert to JSON string
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
@@ -407,7 +525,7 @@ void UGWIZGameInstance::DeserializePoolState()
                 Config.MaxPoolSize = ConfigObject->GetIntegerField(TEXT("MaxPoolSize"));
                 Config.InitialPoolSize = ConfigObject->GetIntegerField(TEXT("InitialPoolSize"));
                 Config.Priority = static_cast<uint8>(ConfigObject->GetNumberField(TEXT("Priority")));
-                Config.Category = ConfigObject->GetStringField(TEXT("Category"));
+                Config.Category = FName(*ConfigObject->GetStringField(TEXT("Category")));
                 
                 PersistentPoolConfigs.Add(ClassName, Config);
             }
@@ -442,7 +560,7 @@ void UGWIZGameInstance::DeserializePoolState()
                         Config.MaxPoolSize = ConfigObject->GetIntegerField(TEXT("MaxPoolSize"));
                         Config.InitialPoolSize = ConfigObject->GetIntegerField(TEXT("InitialPoolSize"));
                         Config.Priority = static_cast<uint8>(ConfigObject->GetNumberField(TEXT("Priority")));
-                        Config.Category = ConfigObject->GetStringField(TEXT("Category"));
+                        Config.Category = FName(*ConfigObject->GetStringField(TEXT("Category")));
                         
                         LevelConfigs.SetPoolConfig(ClassName, Config);
                     }
@@ -452,5 +570,36 @@ void UGWIZGameInstance::DeserializePoolState()
             }
         }
     }
+    
+    // Deserialize learned usage profiles
+    const TSharedPtr<FJsonObject>* UsageProfilesObject;
+    if (RootObject->TryGetObjectField(TEXT("UsageProfiles"), UsageProfilesObject))
+    {
+        for (const auto& LevelPair : (*UsageProfilesObject)->Values)
+        {
+            if (LevelPair.Value->Type != EJson::Object)
+            {
+                continue;
+            }
+            
+            FGWIZLevelUsageProfiles Profiles;
+            for (const auto& ProfilePair : LevelPair.Value->AsObject()->Values)
+            {
+                if (ProfilePair.Value->Type == EJson::Object)
+                {
+                    TSharedPtr<FJsonObject> ProfileObject = ProfilePair.Value->AsObject();
+                    
+                    FGWIZPoolUsageProfile Profile;
+                    Profile.PeakConcurrentUsage = ProfileObject->GetIntegerField(TEXT("PeakConcurrentUsage"));
+                    Profile.P95ConcurrentUsage = ProfileObject->GetIntegerField(TEXT("P95ConcurrentUsage"));
+                    Profile.SessionCount = ProfileObject->GetIntegerField(TEXT("SessionCount"));
+                    
+                    Profiles.Profiles.Add(ProfilePair.Key, Profile);
+                }
+            }
+            
+            LevelUsageProfiles.Add(LevelPair.Key, Profiles);
+        }
+    }
 }
 
@@ -46,6 +46,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
     void CleanupUnusedPoolsForLevel(const FString& LevelName);
 
+    // Learned concurrent usage for a level's pools, keyed by pooled class name
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    FGWIZLevelUsageProfiles GetLevelUsageProfiles(const FString& LevelName) const;
+
+    // Seconds between usage samples while a level is running
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling", meta = (ClampMin = "0.05"))
+    float UsageSampleIntervalSeconds;
+
 protected:
     // Global pooling manager instance
     UPROPERTY()
@@ -59,10 +67,23 @@ protected:
     UPROPERTY()
     TMap<FString, FGWIZLevelPoolConfigs> LevelPoolConfigs;
 
+    // Concurrent usage learned per level, persisted with the pool state
+    UPROPERTY()
+    TMap<FString, FGWIZLevelUsageProfiles> LevelUsageProfiles;
+
     // Pooling system initialization state
     UPROPERTY()
     bool bPoolingSystemInitialized;
 
+    // Level whose usage is currently being sampled
+    FString CurrentLevelName;
+
+    // Usage samples for the current level, keyed by pooled class name
+    TMap<FString, FGWIZConcurrencyHistogram> CurrentLevelUsage;
+
+    // Timer driving SampleLevelUsage
+    FTimerHandle UsageSampleTimerHandle;
+
     // Initialize the pooling system
     void InitializePoolingSystem();
 
@@ -77,6 +98,12 @@ protected:
     void SetupPoolsForLevel(const FString& LevelName);
     void CleanupPoolsForLevel(const FString& LevelName);
 
+    // Usage learning: sample every pool, then fold the samples into the level's profiles when it unloads
+    void BeginLevelUsage(const FString& LevelName);
+    void SampleLevelUsage();
+    void FinishLevelUsage();
+    void QueueLearnedPreWarm(const FString& LevelName);
+
     // Pool state serialization
     void SerializePoolState();
     void DeserializePoolState();
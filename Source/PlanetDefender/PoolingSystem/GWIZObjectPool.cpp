@@ -2,11 +2,50 @@
 
 #include "GWIZObjectPool.h"
 #include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/AudioComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Particles/ParticleSystemComponent.h"
 #include "HAL/PlatformTime.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectHash.h"
 #include "Misc/DateTime.h"
 
+namespace
+{
+    /** Source of UGWIZObjectPool::PoolSerial */
+    std::atomic<uint64> GNextPoolSerial(1);
+
+    /** A thread's cache for one pool */
+    struct FGWIZThreadCacheEntry
+    {
+        uint64 PoolSerial;
+        FGWIZThreadCache* Cache;
+    };
+
+    /**
+     * This thread's caches, most recent last. Entries are matched by serial before the cache is touched,
+     * so entries left behind by destroyed pools are never dereferenced.
+     */
+    thread_local TArray<FGWIZThreadCacheEntry, TInlineAllocator<8>> GThreadCacheEntries;
+
+    /** Upper bound on GThreadCacheEntries; the oldest entry is dropped beyond this */
+    constexpr int32 GMaxThreadCacheEntries = 32;
+}
+
 UGWIZObjectPool::UGWIZObjectPool()
-    : bIsInitialized(false)
+    : TrackedMemoryUsage(0)
+    , bIsInitialized(false)
+    , bThreadSafeMode(false)
+    , ConcurrentAvailable(0)
+    , ConcurrentInUse(0)
+    , ConcurrentHits(0)
+    , ConcurrentMisses(0)
+    , ConcurrentSurplusCount(0)
+    , ConcurrentLifecycle(nullptr)
+    , MagazineSize(0)
+    , PoolSerial(0)
 {
     // Initialize with default configuration
     Config = FGWIZPoolConfig();
@@ -15,6 +54,19 @@ UGWIZObjectPool::UGWIZObjectPool()
 
 UObject* UGWIZObjectPool::GetObject(TSubclassOf<UObject> ObjectClass)
 {
+    FGWIZPoolHandle Handle;
+    return GetObjectWithHandle(ObjectClass, Handle);
+}
+
+UObject* UGWIZObjectPool::GetObjectWithHandle(TSubclassOf<UObject> ObjectClass, FGWIZPoolHandle& OutHandle)
+{
+    return GetObjectWithHook(ObjectClass, OutHandle, nullptr);
+}
+
+UObject* UGWIZObjectPool::GetObjectWithHook(TSubclassOf<UObject> ObjectClass, FGWIZPoolHandle& OutHandle, FGWIZLifecycleHook OnPooledHook)
+{
+    OutHandle.Reset();
+
     if (!ObjectClass)
     {
         LogDebug(TEXT("GetObject: Invalid object class"));
@@ -24,320 +76,1787 @@ UObject* UGWIZObjectPool::GetObject(TSubclassOf<UObject> ObjectClass)
     // Set object class if not already set
     if (!PooledObjectClass)
     {
-        PooledObjectClass = ObjectClass;
+        SetPooledObjectClass(ObjectClass);
     }
 
-    UObject* Object = nullptr;
+    if (bThreadSafeMode)
+    {
+        return AcquireConcurrent(OnPooledHook);
+    }
+
+    bool bWasHit = false;
+    const int32 SlotIndex = CheckoutSlot(bWasHit, OnPooledHook);
+    if (SlotIndex == INDEX_NONE)
+    {
+        LogDebug(TEXT("GetObject: Failed to create new object"));
+        return nullptr;
+    }
+
+    if (Config.bEnableDebug)
+    {
+        LogDebug(bWasHit
+            ? FString::Printf(TEXT("GetObject: Retrieved from pool, remaining: %d"), AvailableSlots.Num())
+            : FString(TEXT("GetObject: Created new object")));
+    }
+
+    // Update statistics
+    UpdateStatistics();
+
+    OutHandle = FGWIZPoolHandle(SlotIndex, Slots[SlotIndex].Generation);
+    return Slots[SlotIndex].Object;
+}
+
+int32 UGWIZObjectPool::GetObjects(TSubclassOf<UObject> ObjectClass, int32 Count, TArray<UObject*>& OutObjects)
+{
+    if (!ObjectClass || Count <= 0)
+    {
+        LogDebug(TEXT("GetObjects: Invalid object class or count"));
+        return 0;
+    }
+
+    // Set object class if not already set
+    if (!PooledObjectClass)
+    {
+        SetPooledObjectClass(ObjectClass);
+    }
+
+    OutObjects.Reserve(OutObjects.Num() + Count);
+
+    if (bThreadSafeMode)
+    {
+        int32 ConcurrentAcquired = 0;
+        for (; ConcurrentAcquired < Count; ++ConcurrentAcquired)
+        {
+            UObject* Object = AcquireConcurrent();
+            if (!Object)
+            {
+                break;
+            }
+            OutObjects.Add(Object);
+        }
+        return ConcurrentAcquired;
+    }
+
+    int32 Acquired = 0;
+    int32 Hits = 0;
+    for (; Acquired < Count; ++Acquired)
+    {
+        bool bWasHit = false;
+        const int32 SlotIndex = CheckoutSlot(bWasHit);
+        if (SlotIndex == INDEX_NONE)
+        {
+            break;
+        }
+
+        OutObjects.Add(Slots[SlotIndex].Object);
+        Hits += bWasHit ? 1 : 0;
+    }
+
+    if (Config.bEnableDebug)
+    {
+        LogDebug(FString::Printf(TEXT("GetObjects: Acquired %d/%d objects (%d from pool), remaining: %d"),
+                                 Acquired, Count, Hits, AvailableSlots.Num()));
+    }
+
+    // One statistics update for the whole batch
+    UpdateStatistics();
+
+    return Acquired;
+}
+
+int32 UGWIZObjectPool::CheckoutSlot(bool& bOutWasHit, FGWIZLifecycleHook OnPooledHook)
+{
+    int32 SlotIndex = INDEX_NONE;
+
+    // Try to get object from pool first
+    if (AvailableSlots.Num() > 0)
+    {
+        SlotIndex = AvailableSlots.Last();
+        UnlinkSlot(SlotIndex);
+        Statistics.PoolHits++;
+        bOutWasHit = true;
+    }
+    else
+    {
+        // Pool is empty, create new object
+        UObject* Object = CreateNewObject();
+        if (Object)
+        {
+            SlotIndex = AllocateSlot(Object);
+        }
+        Statistics.PoolMisses++;
+        bOutWasHit = false;
+    }
+
+    if (SlotIndex != INDEX_NONE)
+    {
+        // Move object to in-use list
+        LinkSlot(SlotIndex, true);
+        if (Config.bEnableMonitoring)
+        {
+            Slots[SlotIndex].CheckoutCycles = FPlatformTime::Cycles64();
+        }
+        
+        // Initialize object for use
+        InitializeObject(SlotIndex, OnPooledHook);
+    }
+
+    return SlotIndex;
+}
+
+void UGWIZObjectPool::ReturnObject(UObject* Object)
+{
+    ReturnObjectWithHook(Object, nullptr);
+}
+
+bool UGWIZObjectPool::ReturnObjectWithHook(UObject* Object, FGWIZLifecycleHook OnUnpooledHook)
+{
+    if (!Object)
+    {
+        LogDebug(TEXT("ReturnObject: Invalid object"));
+        return false;
+    }
+
+    if (bThreadSafeMode)
+    {
+        return ReleaseConcurrent(Object, OnUnpooledHook);
+    }
+
+    int32 SlotIndex = FindSlot(Object);
+    if (SlotIndex == INDEX_NONE)
+    {
+        // Adopt objects the pool did not create
+        SlotIndex = AllocateSlot(Object);
+        LinkSlot(SlotIndex, true);
+    }
+    else if (!Slots[SlotIndex].bInUse)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] ReturnObject: Rejected double return of %s"), *Object->GetName());
+        return false;
+    }
+
+    CheckinSlot(SlotIndex, OnUnpooledHook);
+
+    if (Config.bEnableDebug)
+    {
+        LogDebug(FString::Printf(TEXT("ReturnObject: Returned object, pool size: %d"), AvailableSlots.Num()));
+    }
+
+    // Update statistics
+    UpdateStatistics();
+    return true;
+}
+
+void UGWIZObjectPool::ReturnObjects(const TArray<UObject*>& Objects)
+{
+    if (bThreadSafeMode)
+    {
+        for (UObject* Object : Objects)
+        {
+            if (Object)
+            {
+                ReleaseConcurrent(Object);
+            }
+        }
+        return;
+    }
+
+    int32 Returned = 0;
+    for (UObject* Object : Objects)
+    {
+        if (!Object)
+        {
+            continue;
+        }
+
+        int32 SlotIndex = FindSlot(Object);
+        if (SlotIndex == INDEX_NONE)
+        {
+            // Adopt objects the pool did not create
+            SlotIndex = AllocateSlot(Object);
+            LinkSlot(SlotIndex, true);
+        }
+        else if (!Slots[SlotIndex].bInUse)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] ReturnObjects: Rejected double return of %s"), *Object->GetName());
+            continue;
+        }
+
+        CheckinSlot(SlotIndex);
+        ++Returned;
+    }
+
+    if (Config.bEnableDebug)
+    {
+        LogDebug(FString::Printf(TEXT("ReturnObjects: Returned %d/%d objects, pool size: %d"),
+                                 Returned, Objects.Num(), AvailableSlots.Num()));
+    }
+
+    // One statistics update for the whole batch
+    UpdateStatistics();
+}
+
+bool UGWIZObjectPool::ReturnObjectByHandle(const FGWIZPoolHandle& Handle)
+{
+    return ReturnObjectByHandleWithHook(Handle, nullptr);
+}
+
+bool UGWIZObjectPool::ReturnObjectByHandleWithHook(const FGWIZPoolHandle& Handle, FGWIZLifecycleHook OnUnpooledHook)
+{
+    if (!IsHandleValid(Handle))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] ReturnObjectByHandle: Rejected stale handle (slot %d, generation %d)"),
+               Handle.SlotIndex, Handle.Generation);
+        return false;
+    }
+
+    CheckinSlot(Handle.SlotIndex, OnUnpooledHook);
+    UpdateStatistics();
+    return true;
+}
+
+bool UGWIZObjectPool::IsHandleValid(const FGWIZPoolHandle& Handle) const
+{
+    if (!Slots.IsValidIndex(Handle.SlotIndex))
+    {
+        return false;
+    }
+
+    const FGWIZPoolSlot& Slot = Slots[Handle.SlotIndex];
+    return Slot.bInUse && Slot.Generation == Handle.Generation;
+}
+
+UObject* UGWIZObjectPool::ResolveHandle(const FGWIZPoolHandle& Handle) const
+{
+    return IsHandleValid(Handle) ? Slots[Handle.SlotIndex].Object : nullptr;
+}
+
+FGWIZPoolHandle UGWIZObjectPool::GetHandleForObject(const UObject* Object) const
+{
+    const int32 SlotIndex = FindSlot(Object);
+    if (SlotIndex == INDEX_NONE || !Slots[SlotIndex].bInUse)
+    {
+        return FGWIZPoolHandle();
+    }
+
+    return FGWIZPoolHandle(SlotIndex, Slots[SlotIndex].Generation);
+}
+
+void UGWIZObjectPool::CheckinSlot(int32 SlotIndex, FGWIZLifecycleHook OnUnpooledHook)
+{
+    FGWIZPoolSlot& Slot = Slots[SlotIndex];
+    UObject* Object = Slot.Object;
+
+    // Remove from in-use list and invalidate outstanding handles
+    UnlinkSlot(SlotIndex);
+    BumpGeneration(SlotIndex);
+
+    if (Slot.CheckoutCycles != 0)
+    {
+        LifetimeHistogram.Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Slot.CheckoutCycles));
+        Slot.CheckoutCycles = 0;
+    }
+
+    // Clean up object for pooling
+    CleanupObject(SlotIndex, OnUnpooledHook);
+
+    // Check if we should add to pool or destroy
+    if (AvailableSlots.Num() < Config.MaxPoolSize)
+    {
+        LinkSlot(SlotIndex, false);
+    }
+    else
+    {
+        // Pool is full; the object is destroyed later within the frame budget
+        RetireSlot(SlotIndex);
+        LogDebug(TEXT("ReturnObject: Pool full, queued object for destruction"));
+    }
+}
+
+void UGWIZObjectPool::AddToPool(UObject* Object)
+{
+    if (!ValidateObject(Object))
+    {
+        LogDebug(TEXT("AddToPool: Invalid object"));
+        return;
+    }
+
+    if (GetAvailableCount() >= Config.MaxPoolSize)
+    {
+        LogDebug(TEXT("AddToPool: Pool is full"));
+        return;
+    }
+
+    if (ContainsObject(Object))
+    {
+        LogDebug(TEXT("AddToPool: Object already belongs to this pool"));
+        return;
+    }
+
+    AddIdleObject(Object);
+    LogDebug(FString::Printf(TEXT("AddToPool: Added to pool, size: %d"), GetAvailableCount()));
+    
+    UpdateStatistics();
+}
+
+void UGWIZObjectPool::RemoveFromPool(UObject* Object)
+{
+    if (!Object)
+    {
+        return;
+    }
+
+    if (bThreadSafeMode)
+    {
+        ReclaimThreadCaches();
+
+        // The free list has no random access; drain it and push back everything else
+        TArray<UObject*> FreeObjects;
+        ConcurrentFreeList.PopAll(FreeObjects);
+        for (UObject* FreeObject : FreeObjects)
+        {
+            if (FreeObject == Object)
+            {
+                FScopeLock Lock(&PoolMutex);
+                ConcurrentAvailable.fetch_sub(1, std::memory_order_relaxed);
+                ReleaseSlot(FindSlot(Object));
+            }
+            else
+            {
+                ConcurrentFreeList.Push(FreeObject);
+            }
+        }
+        UpdateStatistics();
+        return;
+    }
+
+    // Only available objects can be removed; objects in use stay tracked until returned
+    const int32 SlotIndex = FindSlot(Object);
+    if (SlotIndex == INDEX_NONE || Slots[SlotIndex].bInUse)
+    {
+        return;
+    }
+
+    // The caller takes ownership, so hand the actor back with its components registered
+    if (Slots[SlotIndex].bDeepParked)
+    {
+        UnparkSlot(Slots[SlotIndex]);
+    }
+
+    UnlinkSlot(SlotIndex);
+    ReleaseSlot(SlotIndex);
+    LogDebug(FString::Printf(TEXT("RemoveFromPool: Removed from pool, size: %d"), AvailableSlots.Num()));
+    
+    UpdateStatistics();
+}
+
+void UGWIZObjectPool::ClearPool()
+{
+    LogDebug(FString::Printf(TEXT("ClearPool: Clearing %d available objects"), GetAvailableCount()));
+    
+    TrimIdleObjects(0);
+    AdaptiveState = FGWIZAdaptiveSizingState();
+
+    // Clearing is teardown, so destroy everything now rather than leaving work for a manager that may be gone
+    ProcessPendingDestroy(TNumericLimits<double>::Max());
+}
+
+int32 UGWIZObjectPool::ProcessPendingDestroy(double DeadlineSeconds)
+{
+    int32 Destroyed = 0;
+
+    // Surplus returned on other threads joins the queue here, on the thread that may destroy it
+    if (bThreadSafeMode && ConcurrentSurplusCount.load(std::memory_order_relaxed) > 0)
+    {
+        TArray<UObject*> Surplus;
+        ConcurrentSurplus.PopAll(Surplus);
+
+        FScopeLock Lock(&PoolMutex);
+        for (UObject* Object : Surplus)
+        {
+            const int32 SlotIndex = FindSlot(Object);
+            if (SlotIndex != INDEX_NONE)
+            {
+                RetireSlot(SlotIndex);
+            }
+        }
+        ConcurrentSurplusCount.fetch_sub(Surplus.Num(), std::memory_order_relaxed);
+    }
+
+    while (PendingDestroy.Num() > 0)
+    {
+        // Objects that were collected or destroyed elsewhere in the meantime cost nothing
+        UObject* Object = PendingDestroy.Pop(EAllowShrinking::No).Get();
+        if (!Object)
+        {
+            continue;
+        }
+
+        if (AActor* Actor = Cast<AActor>(Object))
+        {
+            Actor->Destroy();
+        }
+        else
+        {
+            Object->MarkAsGarbage();
+        }
+        ++Destroyed;
+
+        if (FPlatformTime::Seconds() >= DeadlineSeconds)
+        {
+            break;
+        }
+    }
+
+    if (Destroyed > 0 && Config.bEnableDebug)
+    {
+        LogDebug(FString::Printf(TEXT("ProcessPendingDestroy: Destroyed %d objects, %d pending"), Destroyed, PendingDestroy.Num()));
+    }
+
+    return Destroyed;
+}
+
+void UGWIZObjectPool::PreWarmPool(int32 Count)
+{
+    if (!PooledObjectClass)
+    {
+        LogDebug(TEXT("PreWarmPool: No object class set"));
+        return;
+    }
+
+    const int32 TargetCount = FMath::Min(Count, Config.MaxPoolSize);
+    const int32 CurrentCount = GetAvailableCount();
+    const int32 ToCreate = FMath::Max(0, TargetCount - CurrentCount);
+
+    LogDebug(FString::Printf(TEXT("PreWarmPool: Creating %d objects"), ToCreate));
+
+    for (int32 i = 0; i < ToCreate; ++i)
+    {
+        UObject* Object = CreateNewObject();
+        if (Object)
+        {
+            AddIdleObject(Object);
+        }
+    }
+
+    UpdateStatistics();
+}
+
+int32 UGWIZObjectPool::PreWarmPoolUntil(int32 Count, double DeadlineSeconds)
+{
+    if (!PooledObjectClass)
+    {
+        LogDebug(TEXT("PreWarmPoolUntil: No object class set"));
+        return 0;
+    }
+
+    const int32 TargetCount = FMath::Min(Count, Config.MaxPoolSize);
+    int32 Created = 0;
+
+    // Always create at least one object per call so a tiny budget still makes progress
+    while (GetAvailableCount() < TargetCount)
+    {
+        UObject* Object = CreateNewObject();
+        if (!Object)
+        {
+            break;
+        }
+
+        AddIdleObject(Object);
+        ++Created;
+
+        if (FPlatformTime::Seconds() >= DeadlineSeconds)
+        {
+            break;
+        }
+    }
+
+    if (Created > 0)
+    {
+        UpdateStatistics();
+    }
+
+    return Created;
+}
+
+int32 UGWIZObjectPool::GetPreWarmDeficit(int32 Count) const
+{
+    return FMath::Max(0, FMath::Min(Count, Config.MaxPoolSize) - GetAvailableCount());
+}
+
+FGWIZPoolStatistics UGWIZObjectPool::GetStatistics() const
+{
+    if (bThreadSafeMode)
+    {
+        // Worker threads do not publish; read the live counters
+        FGWIZPoolStatistics Result = Statistics;
+        ReadConcurrentCounters(Result);
+        return Result;
+    }
+
+    FGWIZPoolStatistics Result = Statistics;
+    ReadLifetimeStatistics(Result);
+    return Result;
+}
+
+void UGWIZObjectPool::ReadLifetimeStatistics(FGWIZPoolStatistics& OutStats) const
+{
+    OutStats.LifetimeP50 = static_cast<float>(LifetimeHistogram.GetPercentile(0.50));
+    OutStats.LifetimeP95 = static_cast<float>(LifetimeHistogram.GetPercentile(0.95));
+    OutStats.LifetimeP99 = static_cast<float>(LifetimeHistogram.GetPercentile(0.99));
+
+    uint64 OldestCheckout = 0;
+    for (const int32 SlotIndex : InUseSlots)
+    {
+        const uint64 CheckoutCycles = Slots[SlotIndex].CheckoutCycles;
+        if (CheckoutCycles != 0 && (OldestCheckout == 0 || CheckoutCycles < OldestCheckout))
+        {
+            OldestCheckout = CheckoutCycles;
+        }
+    }
+    OutStats.OldestOutstandingAge = OldestCheckout != 0
+        ? static_cast<float>(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - OldestCheckout))
+        : 0.0f;
+}
+
+void UGWIZObjectPool::PrintDebugInfo()
+{
+    if (!Config.bEnableDebug)
+    {
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("=== GWIZ Object Pool Debug Info ==="));
+    UE_LOG(LogTemp, Log, TEXT("Pool Size: %d"), GetAvailableCount());
+    UE_LOG(LogTemp, Log, TEXT("Objects In Use: %d"), GetInUseCount());
+    UE_LOG(LogTemp, Log, TEXT("Thread Safe: %s"), bThreadSafeMode ? TEXT("Yes") : TEXT("No"));
+    if (MagazineSize > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Thread Caches: %d (magazine size %d), local hits: %d"),
+               ThreadCaches.Num(), MagazineSize, GetStatistics().LocalCacheHits);
+    }
+    UE_LOG(LogTemp, Log, TEXT("Total Created: %d"), Statistics.TotalObjectsCreated);
+    UE_LOG(LogTemp, Log, TEXT("Pool Hits: %d"), Statistics.PoolHits);
+    UE_LOG(LogTemp, Log, TEXT("Pool Misses: %d"), Statistics.PoolMisses);
+    UE_LOG(LogTemp, Log, TEXT("Hit Rate: %.2f%%"), Statistics.HitRate * 100.0f);
+    UE_LOG(LogTemp, Log, TEXT("Memory Usage: %lld bytes"), Statistics.MemoryUsage);
+    UE_LOG(LogTemp, Log, TEXT("================================"));
+}
+
+int64 UGWIZObjectPool::GetMemoryUsage() const
+{
+    // Maintained incrementally whether or not monitoring publishes it into Statistics
+    return TrackedMemoryUsage;
+}
+
+bool UGWIZObjectPool::ValidatePool() const
+{
+    if (bThreadSafeMode)
+    {
+        // Only meaningful while no other thread is using the pool
+        FScopeLock Lock(&PoolMutex);
+        return GetAvailableCount() + GetInUseCount() == SlotLookup.Num();
+    }
+
+    // Check if pool size matches statistics
+    if (AvailableSlots.Num() != Statistics.CurrentPoolSize)
+    {
+        return false;
+    }
+
+    // Check if objects in use matches statistics
+    if (InUseSlots.Num() != Statistics.ObjectsInUse)
+    {
+        return false;
+    }
+
+    // Check if total objects matches statistics
+    if (AvailableSlots.Num() + InUseSlots.Num() != Statistics.GetTotalObjects())
+    {
+        return false;
+    }
+
+    // Check that every object is tracked exactly once
+    if (SlotLookup.Num() != AvailableSlots.Num() + InUseSlots.Num())
+    {
+        return false;
+    }
+
+    return true;
+}
+
+int32 UGWIZObjectPool::GetPoolSize() const
+{
+    return GetAvailableCount();
+}
+
+int32 UGWIZObjectPool::GetObjectsInUse() const
+{
+    return GetInUseCount();
+}
+
+int32 UGWIZObjectPool::GetAcquireCount() const
+{
+    if (!bThreadSafeMode)
+    {
+        return Statistics.PoolHits + Statistics.PoolMisses;
+    }
+
+    int32 Acquires = ConcurrentHits.load(std::memory_order_relaxed) + ConcurrentMisses.load(std::memory_order_relaxed);
+    if (MagazineSize > 0)
+    {
+        FScopeLock Lock(&PoolMutex);
+        for (const TUniquePtr<FGWIZThreadCache>& Cache : ThreadCaches)
+        {
+            Acquires += Cache->LocalAcquires.load(std::memory_order_relaxed);
+        }
+    }
+    return Acquires;
+}
+
+bool UGWIZObjectPool::IsObjectInUse(const UObject* Object) const
+{
+    if (bThreadSafeMode)
+    {
+        // Per-object state is not tracked on the lock-free path; owned objects are treated as in use
+        return ContainsObject(Object);
+    }
+
+    const int32 SlotIndex = FindSlot(Object);
+    return SlotIndex != INDEX_NONE && Slots[SlotIndex].bInUse;
+}
+
+bool UGWIZObjectPool::ContainsObject(const UObject* Object) const
+{
+    if (bThreadSafeMode)
+    {
+        FScopeLock Lock(&PoolMutex);
+        return FindSlot(Object) != INDEX_NONE;
+    }
+
+    return FindSlot(Object) != INDEX_NONE;
+}
+
+bool UGWIZObjectPool::IsPoolEmpty() const
+{
+    return GetAvailableCount() == 0;
+}
+
+bool UGWIZObjectPool::IsPoolFull() const
+{
+    return GetAvailableCount() >= Config.MaxPoolSize;
+}
+
+int32 UGWIZObjectPool::AllocateSlot(UObject* Object)
+{
+    int32 SlotIndex;
+    if (VacantSlots.Num() > 0)
+    {
+        SlotIndex = VacantSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        SlotIndex = Slots.AddDefaulted();
+    }
+
+    FGWIZPoolSlot& Slot = Slots[SlotIndex];
+    Slot.Object = Object;
+    Slot.ListIndex = INDEX_NONE;
+    Slot.bInUse = false;
+    Slot.CheckoutCycles = 0;
+    SlotLookup.Add(Object, SlotIndex);
+    TrackObjectMemory(Object, 1);
+
+    if (bThreadSafeMode)
+    {
+        ConcurrentCheckouts.Track(Object->GetUniqueID());
+    }
+
+    return SlotIndex;
+}
+
+void UGWIZObjectPool::ReleaseSlot(int32 SlotIndex)
+{
+    FGWIZPoolSlot& Slot = Slots[SlotIndex];
+    TrackObjectMemory(Slot.Object, -1);
+    SlotLookup.Remove(Slot.Object);
+
+    if (bThreadSafeMode && Slot.Object)
+    {
+        ConcurrentCheckouts.Untrack(Slot.Object->GetUniqueID());
+    }
+    Slot.Object = nullptr;
+    Slot.ListIndex = INDEX_NONE;
+    Slot.bInUse = false;
+    Slot.Components.Reset();
+    Slot.bDeepParked = false;
+    BumpGeneration(SlotIndex);
+    VacantSlots.Add(SlotIndex);
+}
+
+void UGWIZObjectPool::RetireSlot(int32 SlotIndex)
+{
+    UObject* Object = Slots[SlotIndex].Object;
+    ReleaseSlot(SlotIndex);
+
+    if (Object)
+    {
+        PendingDestroy.Add(Object);
+        if (PendingDestroy.Num() == 1)
+        {
+            OnDestroyQueued.ExecuteIfBound(this);
+        }
+    }
+}
+
+void UGWIZObjectPool::BumpGeneration(int32 SlotIndex)
+{
+    // Wrap back to 1 so a default-constructed handle (generation 0) never matches
+    int32& Generation = Slots[SlotIndex].Generation;
+    Generation = Generation == MAX_int32 ? 1 : Generation + 1;
+}
+
+int32 UGWIZObjectPool::FindSlot(const UObject* Object) const
+{
+    const int32* SlotIndex = Object ? SlotLookup.Find(Object) : nullptr;
+    return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+void UGWIZObjectPool::LinkSlot(int32 SlotIndex, bool bInUse)
+{
+    FGWIZPoolSlot& Slot = Slots[SlotIndex];
+    Slot.bInUse = bInUse;
+    Slot.ListIndex = (bInUse ? InUseSlots : AvailableSlots).Add(SlotIndex);
+}
+
+void UGWIZObjectPool::UnlinkSlot(int32 SlotIndex)
+{
+    FGWIZPoolSlot& Slot = Slots[SlotIndex];
+    TArray<int32>& List = Slot.bInUse ? InUseSlots : AvailableSlots;
+
+    // Swap the last entry into the vacated position so removal stays O(1)
+    const int32 LastSlotIndex = List.Pop(EAllowShrinking::No);
+    if (LastSlotIndex != SlotIndex)
+    {
+        List[Slot.ListIndex] = LastSlotIndex;
+        Slots[LastSlotIndex].ListIndex = Slot.ListIndex;
+    }
+    Slot.ListIndex = INDEX_NONE;
+}
+
+UObject* UGWIZObjectPool::CreateNewObject()
+{
+    if (!PooledObjectClass)
+    {
+        return nullptr;
+    }
+
+    // Actors must be spawned into a world to get registered components; everything else is a plain UObject
+    UObject* Object = nullptr;
+    if (PooledObjectClass->IsChildOf(AActor::StaticClass()))
+    {
+        Object = SpawnDormantActor();
+    }
+    else
+    {
+        Object = NewObject<UObject>(this, PooledObjectClass);
+    }
+
+    if (Object)
+    {
+        Statistics.TotalObjectsCreated++;
+        LogDebug(TEXT("CreateNewObject: Created new object"));
+    }
+
+    return Object;
+}
+
+AActor* UGWIZObjectPool::SpawnDormantActor()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] CreateNewObject: No world available to spawn actor class %s"), *PooledObjectClass->GetName());
+        return nullptr;
+    }
+
+    // Defer construction so the actor can be made dormant before its components register and BeginPlay runs
+    AActor* Actor = World->SpawnActorDeferred<AActor>(
+        PooledObjectClass.Get(),
+        FTransform::Identity,
+        nullptr,
+        nullptr,
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+    );
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    // These only set flags at this point, so the dormant state costs nothing to apply
+    Actor->SetActorHiddenInGame(true);
+    Actor->SetActorEnableCollision(false);
+    Actor->PrimaryActorTick.bStartWithTickEnabled = false;
+
+    // Run the construction script and register components exactly once; reuse only toggles state
+    Actor->FinishSpawning(FTransform::Identity);
+
+    return Actor;
+}
+
+void UGWIZObjectPool::InitializeObject(int32 SlotIndex, FGWIZLifecycleHook OnPooledHook)
+{
+    FGWIZPoolSlot& Slot = Slots[SlotIndex];
+    UObject* Object = Slot.Object;
+    if (!Object)
+    {
+        return;
+    }
+
+    FGWIZClassLifecycle& Lifecycle = GetClassLifecycle(Object->GetClass());
+
+    // Call OnPooled without re-querying the interface
+    if (Config.HasActivationStep(EGWIZPoolActivationStep::InterfaceCallbacks))
+    {
+        if (OnPooledHook)
+        {
+            OnPooledHook(Object);
+        }
+        else
+        {
+            DispatchOnPooled(Object, Lifecycle);
+        }
+    }
+
+    // For actors, only touch the components recorded in the class profile
+    if (Lifecycle.bIsActor)
+    {
+        AActor* Actor = static_cast<AActor*>(Object);
+        const TArray<TWeakObjectPtr<UActorComponent>>& Components = GetSlotComponents(Slot, Lifecycle);
+
+        const bool bTick = Config.HasActivationStep(EGWIZPoolActivationStep::Tick);
+        const bool bVisibility = Config.HasActivationStep(EGWIZPoolActivationStep::Visibility) && Actor->IsHidden();
+        const bool bCollision = Config.HasActivationStep(EGWIZPoolActivationStep::Collision);
+        const bool bActivation = Config.HasActivationStep(EGWIZPoolActivationStep::ComponentActivation);
+
+        if (bTick && Lifecycle.bCanEverTick)
+        {
+            Actor->SetActorTickEnabled(true);
+        }
+        if (bVisibility)
+        {
+            Actor->SetHidden(false);
+        }
+        if (bCollision && !Actor->GetActorEnableCollision())
+        {
+            // Actors spawned dormant start with actor-level collision off; collision is toggled per component afterwards
+            Actor->SetActorEnableCollision(true);
+        }
+
+        // Re-registering recreates render, physics and tick state from the flags set above,
+        // so the per-component visibility, collision and tick work is not needed
+        const bool bWasDeepParked = Slot.bDeepParked;
+        if (bWasDeepParked)
+        {
+            UnparkSlot(Slot);
+        }
+
+        for (int32 Index = 0; Index < Components.Num(); ++Index)
+        {
+            UActorComponent* Component = Components[Index].Get();
+            if (!Component)
+            {
+                continue;
+            }
+
+            const FGWIZComponentProfileEntry& Entry = Lifecycle.ComponentProfile[Index];
+            if (!bWasDeepParked)
+            {
+                if (bVisibility && EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Visibility))
+                {
+                    Component->MarkRenderStateDirty();
+                }
+                if (bCollision && EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Collision))
+                {
+                    static_cast<UPrimitiveComponent*>(Component)->SetCollisionEnabled(Entry.CollisionEnabled);
+                }
+                if (bTick && EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Tick))
+                {
+                    Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+                }
+            }
+            if (bActivation && Component->bAutoActivate)
+            {
+                if (EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Audio))
+                {
+                    static_cast<UAudioComponent*>(Component)->Play();
+                }
+                else if (EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::FX | EGWIZComponentToggle::Activation))
+                {
+                    Component->Activate(true);
+                }
+            }
+        }
+    }
+}
+
+void UGWIZObjectPool::CleanupObject(int32 SlotIndex, FGWIZLifecycleHook OnUnpooledHook)
+{
+    FGWIZPoolSlot& Slot = Slots[SlotIndex];
+    UObject* Object = Slot.Object;
+    if (!Object)
+    {
+        return;
+    }
+
+    FGWIZClassLifecycle& Lifecycle = GetClassLifecycle(Object->GetClass());
+
+    // Call OnUnpooled without re-querying the interface
+    if (Config.HasActivationStep(EGWIZPoolActivationStep::InterfaceCallbacks))
+    {
+        if (OnUnpooledHook)
+        {
+            OnUnpooledHook(Object);
+        }
+        else
+        {
+            DispatchOnUnpooled(Object, Lifecycle);
+        }
+    }
+
+    // For actors, only touch the components recorded in the class profile
+    if (Lifecycle.bIsActor)
+    {
+        AActor* Actor = static_cast<AActor*>(Object);
+        const TArray<TWeakObjectPtr<UActorComponent>>& Components = GetSlotComponents(Slot, Lifecycle);
+
+        const bool bTick = Config.HasActivationStep(EGWIZPoolActivationStep::Tick);
+        const bool bVisibility = Config.HasActivationStep(EGWIZPoolActivationStep::Visibility) && !Actor->IsHidden();
+        const bool bCollision = Config.HasActivationStep(EGWIZPoolActivationStep::Collision);
+        const bool bActivation = Config.HasActivationStep(EGWIZPoolActivationStep::ComponentActivation);
+
+        // Unregistering below tears down render, physics and tick state, so per-component toggles are skipped
+        const bool bDeepPark = Config.bDeepParkActors;
+
+        if (bTick && Lifecycle.bCanEverTick)
+        {
+            Actor->SetActorTickEnabled(false);
+        }
+        if (bVisibility)
+        {
+            Actor->SetHidden(true);
+        }
+
+        for (int32 Index = 0; Index < Components.Num(); ++Index)
+        {
+            UActorComponent* Component = Components[Index].Get();
+            if (!Component)
+            {
+                continue;
+            }
+
+            const FGWIZComponentProfileEntry& Entry = Lifecycle.ComponentProfile[Index];
+            if (bActivation)
+            {
+                if (EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Audio))
+                {
+                    static_cast<UAudioComponent*>(Component)->Stop();
+                }
+                else if (EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::FX))
+                {
+                    // Kill live particles now rather than letting them finish while hidden
+                    static_cast<UFXSystemComponent*>(Component)->DeactivateImmediate();
+                }
+                else if (EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Activation))
+                {
+                    Component->Deactivate();
+                }
+            }
+            if (bDeepPark)
+            {
+                continue;
+            }
+            if (bTick && EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Tick))
+            {
+                Component->SetComponentTickEnabled(false);
+            }
+            if (bCollision && EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Collision))
+            {
+                static_cast<UPrimitiveComponent*>(Component)->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+            }
+            if (bVisibility && EnumHasAnyFlags(Entry.Toggles, EGWIZComponentToggle::Visibility))
+            {
+                Component->MarkRenderStateDirty();
+            }
+        }
+
+        if (bDeepPark)
+        {
+            DeepParkSlot(Slot);
+        }
+
+        // Park at the origin so pooled actors do not interfere with gameplay queries.
+        // Cheap when deep parked, as no components are registered to propagate the transform to.
+        if (Config.HasActivationStep(EGWIZPoolActivationStep::TransformReset))
+        {
+            Actor->SetActorLocationAndRotation(FVector::ZeroVector, FRotator::ZeroRotator);
+        }
+    }
+}
+
+void UGWIZObjectPool::BuildComponentProfile(const AActor* Actor, FGWIZClassLifecycle& Lifecycle)
+{
+    Lifecycle.ComponentProfile.Reset();
+
+    for (const UActorComponent* Component : Actor->GetComponents())
+    {
+        if (!Component)
+        {
+            continue;
+        }
+
+        FGWIZComponentProfileEntry Entry;
+        Entry.ComponentName = Component->GetFName();
+
+        if (const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+        {
+            Entry.Toggles |= EGWIZComponentToggle::Register;
+
+            if (Primitive->IsVisible())
+            {
+                Entry.Toggles |= EGWIZComponentToggle::Visibility;
+            }
+
+            // Ignore the actor-level flag, which is off for actors spawned dormant
+            const ECollisionEnabled::Type CollisionEnabled = Primitive->BodyInstance.GetCollisionEnabled(false);
+            if (CollisionEnabled != ECollisionEnabled::NoCollision)
+            {
+                Entry.Toggles |= EGWIZComponentToggle::Collision;
+                Entry.CollisionEnabled = CollisionEnabled;
+            }
+        }
+
+        if (Component->IsA<UFXSystemComponent>())
+        {
+            Entry.Toggles |= EGWIZComponentToggle::FX;
+        }
+        else if (Component->IsA<UAudioComponent>())
+        {
+            Entry.Toggles |= EGWIZComponentToggle::Audio;
+        }
+        else if (Component->bAutoActivate)
+        {
+            Entry.Toggles |= EGWIZComponentToggle::Activation;
+        }
+
+        if (Component->PrimaryComponentTick.bCanEverTick)
+        {
+            Entry.Toggles |= EGWIZComponentToggle::Tick;
+        }
+
+        // Components that need nothing are never visited again
+        if (Entry.Toggles != EGWIZComponentToggle::None)
+        {
+            Lifecycle.ComponentProfile.Add(Entry);
+        }
+    }
+
+    Lifecycle.bComponentProfileBuilt = true;
+
+    LogDebug(FString::Printf(TEXT("BuildComponentProfile: %s has %d of %d components to toggle"),
+                             *Actor->GetClass()->GetName(), Lifecycle.ComponentProfile.Num(), Actor->GetComponents().Num()));
+}
+
+int32 UGWIZObjectPool::AddIdleObject(UObject* Object)
+{
+    if (bThreadSafeMode)
+    {
+        int32 ConcurrentSlotIndex;
+        {
+            FScopeLock Lock(&PoolMutex);
+            ConcurrentSlotIndex = AllocateSlot(Object);
+        }
+        ConcurrentFreeList.Push(Object);
+        ConcurrentAvailable.fetch_add(1, std::memory_order_relaxed);
+        return ConcurrentSlotIndex;
+    }
+
+    const int32 SlotIndex = AllocateSlot(Object);
+    LinkSlot(SlotIndex, false);
+
+    // New actors are registered by FinishSpawning; park them straight away
+    if (Config.bDeepParkActors)
+    {
+        FGWIZPoolSlot& Slot = Slots[SlotIndex];
+        if (GetClassLifecycle(Object->GetClass()).bIsActor)
+        {
+            DeepParkSlot(Slot);
+        }
+    }
+
+    return SlotIndex;
+}
+
+void UGWIZObjectPool::DeepParkSlot(FGWIZPoolSlot& Slot)
+{
+    FGWIZClassLifecycle& Lifecycle = GetClassLifecycle(Slot.Object->GetClass());
+    const TArray<TWeakObjectPtr<UActorComponent>>& Components = GetSlotComponents(Slot, Lifecycle);
+
+    // Reverse profile order; UnparkSlot registers in profile order
+    for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+    {
+        UActorComponent* Component = Components[Index].Get();
+        if (Component && Component->IsRegistered())
+        {
+            Component->UnregisterComponent();
+        }
+    }
+
+    Slot.bDeepParked = true;
+}
+
+void UGWIZObjectPool::UnparkSlot(FGWIZPoolSlot& Slot)
+{
+    for (const TWeakObjectPtr<UActorComponent>& ComponentPtr : Slot.Components)
+    {
+        UActorComponent* Component = ComponentPtr.Get();
+        if (Component && !Component->IsRegistered())
+        {
+            Component->RegisterComponent();
+        }
+    }
+
+    Slot.bDeepParked = false;
+}
+
+const TArray<TWeakObjectPtr<UActorComponent>>& UGWIZObjectPool::GetSlotComponents(FGWIZPoolSlot& Slot, FGWIZClassLifecycle& Lifecycle)
+{
+    if (!Lifecycle.bComponentProfileBuilt)
+    {
+        BuildComponentProfile(static_cast<const AActor*>(Slot.Object), Lifecycle);
+    }
+
+    // Resolve by name once per slot; instances of one class share component names
+    if (Slot.Components.Num() != Lifecycle.ComponentProfile.Num())
+    {
+        Slot.Components.Reset(Lifecycle.ComponentProfile.Num());
+        for (const FGWIZComponentProfileEntry& Entry : Lifecycle.ComponentProfile)
+        {
+            Slot.Components.Add(FindObjectFast<UActorComponent>(Slot.Object, Entry.ComponentName));
+        }
+    }
+
+    return Slot.Components;
+}
+
+void UGWIZObjectPool::DispatchOnPooled(UObject* Object)
+{
+    if (Object)
+    {
+        DispatchOnPooled(Object, GetClassLifecycle(Object->GetClass()));
+    }
+}
+
+void UGWIZObjectPool::DispatchOnUnpooled(UObject* Object)
+{
+    if (Object)
+    {
+        DispatchOnUnpooled(Object, GetClassLifecycle(Object->GetClass()));
+    }
+}
+
+void UGWIZObjectPool::DispatchOnPooled(UObject* Object, const FGWIZClassLifecycle& Lifecycle)
+{
+    switch (Lifecycle.Dispatch)
+    {
+    case EGWIZPoolableDispatch::Native:
+        reinterpret_cast<IGWIZPoolable*>(reinterpret_cast<uint8*>(Object) + Lifecycle.NativeInterfaceOffset)->OnPooled_Implementation();
+        break;
+    case EGWIZPoolableDispatch::Blueprint:
+        Object->ProcessEvent(Lifecycle.OnPooledFunction, nullptr);
+        break;
+    default:
+        break;
+    }
+}
+
+void UGWIZObjectPool::DispatchOnUnpooled(UObject* Object, const FGWIZClassLifecycle& Lifecycle)
+{
+    switch (Lifecycle.Dispatch)
+    {
+    case EGWIZPoolableDispatch::Native:
+        reinterpret_cast<IGWIZPoolable*>(reinterpret_cast<uint8*>(Object) + Lifecycle.NativeInterfaceOffset)->OnUnpooled_Implementation();
+        break;
+    case EGWIZPoolableDispatch::Blueprint:
+        Object->ProcessEvent(Lifecycle.OnUnpooledFunction, nullptr);
+        break;
+    default:
+        break;
+    }
+}
+
+FGWIZClassLifecycle& UGWIZObjectPool::GetClassLifecycle(const UClass* ObjectClass)
+{
+    // Pools almost always hold a single class, so check the last one first
+    if (ObjectClass == LastLifecycleClass && LastLifecycle != nullptr)
+    {
+        return *LastLifecycle;
+    }
+
+    TUniquePtr<FGWIZClassLifecycle>* Found = ClassLifecycles.Find(ObjectClass);
+    if (Found == nullptr)
+    {
+        Found = &ClassLifecycles.Add(ObjectClass, MakeUnique<FGWIZClassLifecycle>(ResolveClassLifecycle(ObjectClass)));
+    }
+
+    LastLifecycleClass = ObjectClass;
+    LastLifecycle = Found->Get();
+    return *LastLifecycle;
+}
+
+FGWIZClassLifecycle UGWIZObjectPool::ResolveClassLifecycle(const UClass* ObjectClass)
+{
+    FGWIZClassLifecycle Lifecycle;
+
+    Lifecycle.bIsActor = ObjectClass->IsChildOf(AActor::StaticClass());
+    if (Lifecycle.bIsActor)
+    {
+        Lifecycle.bCanEverTick = GetDefault<AActor>(const_cast<UClass*>(ObjectClass))->PrimaryActorTick.bCanEverTick;
+    }
+
+    if (ObjectClass->ImplementsInterface(UGWIZPoolable::StaticClass()))
+    {
+        UFunction* OnPooledFunction = ObjectClass->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(IGWIZPoolable, OnPooled));
+        UFunction* OnUnpooledFunction = ObjectClass->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(IGWIZPoolable, OnUnpooled));
+
+        // A C++ implementation that no Blueprint overrides can be called through the vtable
+        const UObject* DefaultObject = ObjectClass->GetDefaultObject();
+        const void* NativeInterface = DefaultObject->GetNativeInterfaceAddress(UGWIZPoolable::StaticClass());
+        const bool bNativeFunctions = (!OnPooledFunction || OnPooledFunction->HasAnyFunctionFlags(FUNC_Native))
+                                   && (!OnUnpooledFunction || OnUnpooledFunction->HasAnyFunctionFlags(FUNC_Native));
+
+        if (NativeInterface != nullptr && bNativeFunctions)
+        {
+            Lifecycle.Dispatch = EGWIZPoolableDispatch::Native;
+            Lifecycle.NativeInterfaceOffset = static_cast<int32>(static_cast<const uint8*>(NativeInterface) - reinterpret_cast<const uint8*>(DefaultObject));
+        }
+        else if (OnPooledFunction != nullptr && OnUnpooledFunction != nullptr)
+        {
+            Lifecycle.Dispatch = EGWIZPoolableDispatch::Blueprint;
+            Lifecycle.OnPooledFunction = OnPooledFunction;
+            Lifecycle.OnUnpooledFunction = OnUnpooledFunction;
+        }
+    }
+
+    LogDebug(FString::Printf(TEXT("ResolveClassLifecycle: %s dispatch=%d actor=%d"),
+                             *ObjectClass->GetName(), static_cast<int32>(Lifecycle.Dispatch), Lifecycle.bIsActor ? 1 : 0));
+
+    return Lifecycle;
+}
+
+void UGWIZObjectPool::UpdateStatistics()
+{
+    if (bThreadSafeMode)
+    {
+        ReadConcurrentCounters(Statistics);
+    }
+    else
+    {
+        Statistics.CurrentPoolSize = AvailableSlots.Num();
+        Statistics.ObjectsInUse = InUseSlots.Num();
+    }
+    Statistics.LastUpdateTime = FPlatformTime::Seconds();
+    
+    Statistics.AverageLifetime = static_cast<float>(LifetimeHistogram.GetMean());
+
+    // Update peak concurrent usage
+    Statistics.PeakConcurrentUsage = FMath::Max(Statistics.PeakConcurrentUsage, Statistics.ObjectsInUse);
+    AdaptiveState.PeakInUseSinceSample = FMath::Max(AdaptiveState.PeakInUseSinceSample, Statistics.ObjectsInUse);
+
+    // Calculate hit rate
+    Statistics.CalculateHitRate();
+
+    // Publish memory usage if monitoring is enabled; the total itself is maintained incrementally
+    if (Config.bEnableMonitoring)
+    {
+        Statistics.MemoryUsage = TrackedMemoryUsage;
+    }
+}
+
+void UGWIZObjectPool::ReadConcurrentCounters(FGWIZPoolStatistics& OutStats) const
+{
+    OutStats.CurrentPoolSize = GetConcurrentAvailableCount();
+    OutStats.ObjectsInUse = GetConcurrentInUseCount();
+    OutStats.PoolHits = ConcurrentHits.load(std::memory_order_relaxed);
+    OutStats.PoolMisses = ConcurrentMisses.load(std::memory_order_relaxed);
+    OutStats.LocalCacheHits = 0;
+
+    if (MagazineSize > 0)
+    {
+        FScopeLock Lock(&PoolMutex);
+        for (const TUniquePtr<FGWIZThreadCache>& Cache : ThreadCaches)
+        {
+            const int32 LocalAcquires = Cache->LocalAcquires.load(std::memory_order_relaxed);
+            OutStats.PoolHits += LocalAcquires;
+            OutStats.LocalCacheHits += LocalAcquires + Cache->LocalReleases.load(std::memory_order_relaxed);
+        }
+    }
+
+    OutStats.CalculateHitRate();
+}
+
+void UGWIZObjectPool::SetPooledObjectClass(TSubclassOf<UObject> ObjectClass)
+{
+    PooledObjectClass = ObjectClass;
+    UpdateThreadingMode();
+}
+
+void UGWIZObjectPool::UpdateThreadingMode()
+{
+    // Switching paths would strand objects in the other free list
+    if (SlotLookup.Num() > 0 || !IsInGameThread())
+    {
+        return;
+    }
+
+    bThreadSafeMode = false;
+    ConcurrentLifecycle = nullptr;
+    MagazineSize = 0;
+
+    if (!Config.bEnableThreadSafety || !PooledObjectClass)
+    {
+        return;
+    }
+
+    if (PooledObjectClass->IsChildOf(AActor::StaticClass()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] Thread safety is not supported for actor class %s; using the game thread path"),
+               *PooledObjectClass->GetName());
+        return;
+    }
+
+    // Resolve here so worker threads never touch the lifecycle map
+    ConcurrentLifecycle = &GetClassLifecycle(PooledObjectClass);
+    if (ConcurrentLifecycle->Dispatch == EGWIZPoolableDispatch::Blueprint)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] Blueprint OnPooled/OnUnpooled on %s will not be called in thread-safe mode"),
+               *PooledObjectClass->GetName());
+    }
+
+    // Sized before any other thread can see the pool in thread-safe mode
+    ConcurrentCheckouts.Initialize(GUObjectArray.GetObjectArrayCapacity());
+
+    MagazineSize = FMath::Max(0, Config.ThreadCacheMagazineSize);
+    if (MagazineSize > 0 && PoolSerial == 0)
+    {
+        PoolSerial = GNextPoolSerial.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bThreadSafeMode = true;
+    LogDebug(FString::Printf(TEXT("UpdateThreadingMode: Lock-free path enabled for %s (magazine size %d)"),
+                             *PooledObjectClass->GetName(), MagazineSize));
+}
+
+UObject* UGWIZObjectPool::AcquireConcurrent(FGWIZLifecycleHook OnPooledHook)
+{
+    UObject* Object = nullptr;
+
+    if (MagazineSize > 0)
+    {
+        FGWIZThreadCache& Cache = GetThreadCache();
+        if (Cache.Objects.Num() > 0)
+        {
+            // Fast path: no shared state touched
+            FGWIZThreadCache::Bump(Cache.LocalAcquires, 1);
+        }
+        else
+        {
+            RefillThreadCache(Cache);
+            if (Cache.Objects.Num() > 0)
+            {
+                ConcurrentHits.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        if (Cache.Objects.Num() > 0)
+        {
+            Object = Cache.Objects.Pop(EAllowShrinking::No);
+            FGWIZThreadCache::Bump(Cache.CachedCount, -1);
+            FGWIZThreadCache::Bump(Cache.NetCheckouts, 1);
+            ConcurrentCheckouts.TryCheckOut(Object->GetUniqueID());
+
+            if (Config.HasActivationStep(EGWIZPoolActivationStep::InterfaceCallbacks))
+            {
+                if (OnPooledHook)
+                {
+                    OnPooledHook(Object);
+                }
+                else if (ConcurrentLifecycle->Dispatch == EGWIZPoolableDispatch::Native)
+                {
+                    DispatchOnPooled(Object, *ConcurrentLifecycle);
+                }
+            }
+            return Object;
+        }
+    }
+    else
+    {
+        Object = ConcurrentFreeList.Pop();
+    }
 
-    // Try to get object from pool first
-    if (AvailableObjects.Num() > 0)
+    if (Object)
     {
-        Object = AvailableObjects.Pop();
-        Statistics.PoolHits++;
-        LogDebug(FString::Printf(TEXT("GetObject: Retrieved from pool, remaining: %d"), AvailableObjects.Num()));
+        ConcurrentAvailable.fetch_sub(1, std::memory_order_relaxed);
+        ConcurrentHits.fetch_add(1, std::memory_order_relaxed);
     }
     else
     {
-        // Pool is empty, create new object
+        ConcurrentMisses.fetch_add(1, std::memory_order_relaxed);
+
+        // UObjects can only be constructed on the game thread
+        if (!IsInGameThread())
+        {
+            return nullptr;
+        }
+
         Object = CreateNewObject();
-        Statistics.PoolMisses++;
-        LogDebug(TEXT("GetObject: Created new object"));
+        if (!Object)
+        {
+            return nullptr;
+        }
+
+        FScopeLock Lock(&PoolMutex);
+        AllocateSlot(Object);
     }
 
-    if (Object)
+    ConcurrentInUse.fetch_add(1, std::memory_order_relaxed);
+    ConcurrentCheckouts.TryCheckOut(Object->GetUniqueID());
+
+    if (Config.HasActivationStep(EGWIZPoolActivationStep::InterfaceCallbacks))
     {
-        // Move object to in-use list
-        ObjectsInUse.Add(Object);
-        
-        // Initialize object for use
-        InitializeObject(Object);
-        
-        // Update statistics
-        UpdateStatistics();
+        if (OnPooledHook)
+        {
+            OnPooledHook(Object);
+        }
+        else if (ConcurrentLifecycle->Dispatch == EGWIZPoolableDispatch::Native)
+        {
+            DispatchOnPooled(Object, *ConcurrentLifecycle);
+        }
     }
 
     return Object;
 }
 
-void UGWIZObjectPool::ReturnObject(UObject* Object)
+bool UGWIZObjectPool::ReleaseConcurrent(UObject* Object, FGWIZLifecycleHook OnUnpooledHook)
 {
-    if (!Object)
+    // Objects the pool created are always owned; anything else has to be checked against the slot table
+    if (Object->GetOuter() != this && !ContainsObject(Object))
     {
-        LogDebug(TEXT("ReturnObject: Invalid object"));
-        return;
+        UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] ReturnObject: %s does not belong to this thread-safe pool; use AddToPool on the game thread"),
+               *Object->GetName());
+        return false;
     }
 
-    // Remove from in-use list
-    ObjectsInUse.Remove(Object);
-
-    // Clean up object for pooling
-    CleanupObject(Object);
-
-    // Check if we should add to pool or destroy
-    if (AvailableObjects.Num() < Config.MaxPoolSize)
+    // Only one return per checkout can clear the flag, so a double return never reaches a free list twice
+    if (!ConcurrentCheckouts.TryCheckIn(Object->GetUniqueID()))
     {
-        AvailableObjects.Add(Object);
-        LogDebug(FString::Printf(TEXT("ReturnObject: Added to pool, size: %d"), AvailableObjects.Num()));
+        UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] ReturnObject: %s is not checked out (returned twice?)"), *Object->GetName());
+        return false;
     }
-    else
+
+    if (Config.HasActivationStep(EGWIZPoolActivationStep::InterfaceCallbacks))
     {
-        // Pool is full, destroy object
-        LogDebug(TEXT("ReturnObject: Pool full, destroying object"));
-        // Note: In Unreal, we typically don't manually destroy UObjects
-        // They're garbage collected when no references remain
+        if (OnUnpooledHook)
+        {
+            OnUnpooledHook(Object);
+        }
+        else if (ConcurrentLifecycle->Dispatch == EGWIZPoolableDispatch::Native)
+        {
+            DispatchOnUnpooled(Object, *ConcurrentLifecycle);
+        }
     }
 
-    // Update statistics
-    UpdateStatistics();
-}
-
-void UGWIZObjectPool::AddToPool(UObject* Object)
-{
-    if (!ValidateObject(Object))
+    // Beyond MaxPoolSize the object is surplus. Only the game thread may destroy it, so it is handed over; the
+    // count goes up before the push so the game thread never drops the pool from its work list too early
+    FGWIZThreadCache* Cache = MagazineSize > 0 ? &GetThreadCache() : nullptr;
+    const int32 Available = ConcurrentAvailable.load(std::memory_order_relaxed) + (Cache != nullptr ? Cache->Objects.Num() : 0);
+    if (Available >= Config.MaxPoolSize)
     {
-        LogDebug(TEXT("AddToPool: Invalid object"));
-        return;
+        if (Cache != nullptr)
+        {
+            FGWIZThreadCache::Bump(Cache->NetCheckouts, -1);
+        }
+        else
+        {
+            ConcurrentInUse.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        const bool bFirstSurplus = ConcurrentSurplusCount.fetch_add(1, std::memory_order_relaxed) == 0;
+        ConcurrentSurplus.Push(Object);
+        if (bFirstSurplus)
+        {
+            OnDestroyQueued.ExecuteIfBound(this);
+        }
+        return true;
     }
 
-    if (AvailableObjects.Num() >= Config.MaxPoolSize)
+    if (Cache != nullptr)
     {
-        LogDebug(TEXT("AddToPool: Pool is full"));
-        return;
+        Cache->Objects.Add(Object);
+        FGWIZThreadCache::Bump(Cache->CachedCount, 1);
+        FGWIZThreadCache::Bump(Cache->NetCheckouts, -1);
+
+        // Keep up to two magazines locally so alternating acquire/release never crosses the threshold
+        if (Cache->Objects.Num() > MagazineSize * 2)
+        {
+            FlushThreadCache(*Cache);
+        }
+        else
+        {
+            FGWIZThreadCache::Bump(Cache->LocalReleases, 1);
+        }
+        return true;
     }
 
-    AvailableObjects.Add(Object);
-    LogDebug(FString::Printf(TEXT("AddToPool: Added to pool, size: %d"), AvailableObjects.Num()));
-    
-    UpdateStatistics();
+    ConcurrentInUse.fetch_sub(1, std::memory_order_relaxed);
+    ConcurrentFreeList.Push(Object);
+    ConcurrentAvailable.fetch_add(1, std::memory_order_relaxed);
+    return true;
 }
 
-void UGWIZObjectPool::RemoveFromPool(UObject* Object)
+FGWIZThreadCache& UGWIZObjectPool::GetThreadCache()
 {
-    if (!Object)
+    // Most threads use one or two pools, so the entry is usually the last one
+    for (int32 Index = GThreadCacheEntries.Num() - 1; Index >= 0; --Index)
     {
-        return;
+        if (GThreadCacheEntries[Index].PoolSerial == PoolSerial)
+        {
+            return *GThreadCacheEntries[Index].Cache;
+        }
     }
 
-    AvailableObjects.Remove(Object);
-    LogDebug(FString::Printf(TEXT("RemoveFromPool: Removed from pool, size: %d"), AvailableObjects.Num()));
-    
-    UpdateStatistics();
-}
+    FGWIZThreadCache* Cache;
+    {
+        FScopeLock Lock(&PoolMutex);
+        Cache = ThreadCaches.Add_GetRef(MakeUnique<FGWIZThreadCache>()).Get();
+    }
+    Cache->Objects.Reserve(MagazineSize * 2 + 1);
 
-void UGWIZObjectPool::ClearPool()
-{
-    LogDebug(FString::Printf(TEXT("ClearPool: Clearing %d available objects"), AvailableObjects.Num()));
-    
-    AvailableObjects.Empty();
-    UpdateStatistics();
+    // A dropped entry only strands that cache's objects until the pool is next cleared or shrunk
+    if (GThreadCacheEntries.Num() >= GMaxThreadCacheEntries)
+    {
+        GThreadCacheEntries.RemoveAt(0);
+    }
+    GThreadCacheEntries.Add({ PoolSerial, Cache });
+    return *Cache;
 }
 
-void UGWIZObjectPool::PreWarmPool(int32 Count)
+void UGWIZObjectPool::RefillThreadCache(FGWIZThreadCache& Cache)
 {
-    if (!PooledObjectClass)
+    // Take a whole magazine from the depot in one operation when there is one
+    if (FGWIZObjectMagazine* Magazine = FullMagazines.Pop())
     {
-        LogDebug(TEXT("PreWarmPool: No object class set"));
+        const int32 Count = Magazine->Objects.Num();
+        Cache.Objects.Append(Magazine->Objects);
+        Magazine->Objects.Reset();
+        EmptyMagazines.Push(Magazine);
+
+        ConcurrentAvailable.fetch_sub(Count, std::memory_order_relaxed);
+        FGWIZThreadCache::Bump(Cache.CachedCount, Count);
         return;
     }
 
-    const int32 TargetCount = FMath::Min(Count, Config.MaxPoolSize);
-    const int32 CurrentCount = AvailableObjects.Num();
-    const int32 ToCreate = FMath::Max(0, TargetCount - CurrentCount);
-
-    LogDebug(FString::Printf(TEXT("PreWarmPool: Creating %d objects"), ToCreate));
-
-    for (int32 i = 0; i < ToCreate; ++i)
+    // Otherwise gather loose objects from the free list
+    int32 Count = 0;
+    while (Count < MagazineSize)
     {
-        UObject* Object = CreateNewObject();
-        if (Object)
+        UObject* Object = ConcurrentFreeList.Pop();
+        if (!Object)
         {
-            AvailableObjects.Add(Object);
+            break;
         }
+        Cache.Objects.Add(Object);
+        ++Count;
     }
 
-    UpdateStatistics();
-}
-
-FGWIZPoolStatistics UGWIZObjectPool::GetStatistics() const
-{
-    return Statistics;
+    if (Count > 0)
+    {
+        ConcurrentAvailable.fetch_sub(Count, std::memory_order_relaxed);
+        FGWIZThreadCache::Bump(Cache.CachedCount, Count);
+    }
 }
 
-void UGWIZObjectPool::PrintDebugInfo()
+void UGWIZObjectPool::FlushThreadCache(FGWIZThreadCache& Cache)
 {
-    if (!Config.bEnableDebug)
+    FGWIZObjectMagazine* Magazine = EmptyMagazines.Pop();
+    if (!Magazine)
     {
-        return;
+        FScopeLock Lock(&PoolMutex);
+        Magazine = AllMagazines.Add_GetRef(MakeUnique<FGWIZObjectMagazine>()).Get();
+        Magazine->Objects.Reserve(MagazineSize);
     }
 
-    UE_LOG(LogTemp, Log, TEXT("=== GWIZ Object Pool Debug Info ==="));
-    UE_LOG(LogTemp, Log, TEXT("Pool Size: %d"), AvailableObjects.Num());
-    UE_LOG(LogTemp, Log, TEXT("Objects In Use: %d"), ObjectsInUse.Num());
-    UE_LOG(LogTemp, Log, TEXT("Total Created: %d"), Statistics.TotalObjectsCreated);
-    UE_LOG(LogTemp, Log, TEXT("Pool Hits: %d"), Statistics.PoolHits);
-    UE_LOG(LogTemp, Log, TEXT("Pool Misses: %d"), Statistics.PoolMisses);
-    UE_LOG(LogTemp, Log, TEXT("Hit Rate: %.2f%%"), Statistics.HitRate * 100.0f);
-    UE_LOG(LogTemp, Log, TEXT("Memory Usage: %lld bytes"), Statistics.MemoryUsage);
-    UE_LOG(LogTemp, Log, TEXT("================================"));
-}
+    // Hand the oldest objects to the depot and keep the recently used (cache-warm) ones
+    Magazine->Objects.Append(Cache.Objects.GetData(), MagazineSize);
+    Cache.Objects.RemoveAt(0, MagazineSize, EAllowShrinking::No);
+    FGWIZThreadCache::Bump(Cache.CachedCount, -MagazineSize);
 
-int64 UGWIZObjectPool::GetMemoryUsage() const
-{
-    return Statistics.MemoryUsage;
+    ConcurrentAvailable.fetch_add(MagazineSize, std::memory_order_relaxed);
+    FullMagazines.Push(Magazine);
 }
 
-bool UGWIZObjectPool::ValidatePool() const
+void UGWIZObjectPool::ReclaimThreadCaches()
 {
-    // Check if pool size matches statistics
-    if (AvailableObjects.Num() != Statistics.CurrentPoolSize)
+    if (MagazineSize <= 0)
     {
-        return false;
+        return;
     }
 
-    // Check if objects in use matches statistics
-    if (ObjectsInUse.Num() != Statistics.ObjectsInUse)
+    FScopeLock Lock(&PoolMutex);
+
+    while (FGWIZObjectMagazine* Magazine = FullMagazines.Pop())
     {
-        return false;
+        for (UObject* Object : Magazine->Objects)
+        {
+            ConcurrentFreeList.Push(Object);
+        }
+        Magazine->Objects.Reset();
+        EmptyMagazines.Push(Magazine);
     }
 
-    // Check if total objects matches statistics
-    if (AvailableObjects.Num() + ObjectsInUse.Num() != Statistics.GetTotalObjects())
+    for (const TUniquePtr<FGWIZThreadCache>& Cache : ThreadCaches)
     {
-        return false;
+        const int32 Count = Cache->Objects.Num();
+        for (UObject* Object : Cache->Objects)
+        {
+            ConcurrentFreeList.Push(Object);
+        }
+        Cache->Objects.Reset();
+        Cache->CachedCount.store(0, std::memory_order_relaxed);
+        ConcurrentAvailable.fetch_add(Count, std::memory_order_relaxed);
     }
-
-    return true;
-}
-
-int32 UGWIZObjectPool::GetPoolSize() const
-{
-    return AvailableObjects.Num();
-}
-
-int32 UGWIZObjectPool::GetObjectsInUse() const
-{
-    return ObjectsInUse.Num();
-}
-
-bool UGWIZObjectPool::IsPoolEmpty() const
-{
-    return AvailableObjects.Num() == 0;
-}
-
-bool UGWIZObjectPool::IsPoolFull() const
-{
-    return AvailableObjects.Num() >= Config.MaxPoolSize;
 }
 
-UObject* UGWIZObjectPool::CreateNewObject()
+int32 UGWIZObjectPool::GetConcurrentAvailableCount() const
 {
-    if (!PooledObjectClass)
+    int32 Count = ConcurrentAvailable.load(std::memory_order_relaxed);
+    if (MagazineSize > 0)
     {
-        return nullptr;
+        FScopeLock Lock(&PoolMutex);
+        for (const TUniquePtr<FGWIZThreadCache>& Cache : ThreadCaches)
+        {
+            Count += Cache->CachedCount.load(std::memory_order_relaxed);
+        }
     }
+    return Count;
+}
 
-    UObject* Object = NewObject<UObject>(this, PooledObjectClass);
-    if (Object)
+int32 UGWIZObjectPool::GetConcurrentInUseCount() const
+{
+    int32 Count = ConcurrentInUse.load(std::memory_order_relaxed);
+    if (MagazineSize > 0)
     {
-        Statistics.TotalObjectsCreated++;
-        LogDebug(TEXT("CreateNewObject: Created new object"));
+        FScopeLock Lock(&PoolMutex);
+        for (const TUniquePtr<FGWIZThreadCache>& Cache : ThreadCaches)
+        {
+            Count += Cache->NetCheckouts.load(std::memory_order_relaxed);
+        }
     }
-
-    return Object;
+    return Count;
 }
 
-void UGWIZObjectPool::InitializeObject(UObject* Object)
+void UGWIZObjectPool::TrackObjectMemory(const UObject* Object, int32 CountDelta)
 {
     if (!Object)
     {
         return;
     }
 
-    // Check if object implements the poolable interface
-    if (Object->GetClass()->ImplementsInterface(UGWIZPoolable::StaticClass()))
+    const UClass* ObjectClass = Object->GetClass();
+    FGWIZClassMemoryInfo* MemoryInfo = ClassMemory.Find(ObjectClass);
+    if (!MemoryInfo)
     {
-        IGWIZPoolable::Execute_OnPooled(Object);
+        // First object of this class, measure it once; RefreshMemoryMeasurement keeps it current
+        MemoryInfo = &ClassMemory.Add(ObjectClass);
+        MemoryInfo->ObjectSize = MeasureObjectMemory(Object);
+        MemoryInfo->MeasuredTime = FPlatformTime::Seconds();
     }
 
-    // For actors, we can do additional initialization
-    if (AActor* Actor = Cast<AActor>(Object))
-    {
-        // Enable ticking and rendering
-        Actor->SetActorTickEnabled(true);
-        Actor->SetActorHiddenInGame(false);
-        Actor->SetActorEnableCollision(true);
-    }
+    MemoryInfo->ObjectCount += CountDelta;
+    TrackedMemoryUsage += MemoryInfo->ObjectSize * CountDelta;
 }
 
-void UGWIZObjectPool::CleanupObject(UObject* Object)
+int64 UGWIZObjectPool::MeasureObjectMemory(const UObject* Object)
 {
-    if (!Object)
-    {
-        return;
-    }
+    UObject* MutableObject = const_cast<UObject*>(Object);
+    int64 Size = static_cast<int64>(MutableObject->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal));
 
-    // Check if object implements the poolable interface
-    if (Object->GetClass()->ImplementsInterface(UGWIZPoolable::StaticClass()))
-    {
-        IGWIZPoolable::Execute_OnUnpooled(Object);
-    }
+    // AActor::GetResourceSizeEx already adds its components, so only count the actor's other subobjects
+    const AActor* Actor = Cast<AActor>(Object);
 
-    // For actors, we can do additional cleanup
-    if (AActor* Actor = Cast<AActor>(Object))
+    TArray<UObject*> Subobjects;
+    GetObjectsWithOuter(Object, Subobjects, true);
+    for (UObject* Subobject : Subobjects)
     {
-        // Disable ticking and rendering
-        Actor->SetActorTickEnabled(false);
-        Actor->SetActorHiddenInGame(true);
-        Actor->SetActorEnableCollision(false);
+        const UActorComponent* Component = Actor ? Cast<UActorComponent>(Subobject) : nullptr;
+        if (Component && Component->GetOwner() == Actor)
+        {
+            continue;
+        }
+        Size += static_cast<int64>(Subobject->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal));
     }
+
+    return Size;
 }
 
-void UGWIZObjectPool::UpdateStatistics()
+bool UGWIZObjectPool::RefreshMemoryMeasurement(double Now)
 {
-    Statistics.CurrentPoolSize = AvailableObjects.Num();
-    Statistics.ObjectsInUse = ObjectsInUse.Num();
-    Statistics.LastUpdateTime = FPlatformTime::Seconds();
-    
-    // Update peak concurrent usage
-    const int32 TotalObjects = Statistics.GetTotalObjects();
-    if (TotalObjects > Statistics.PeakConcurrentUsage)
+    FScopeLock Lock(&PoolMutex);
+
+    // Pick the stalest class that still has instances
+    const UClass* StalestClass = nullptr;
+    FGWIZClassMemoryInfo* StalestInfo = nullptr;
+    for (TPair<const UClass*, FGWIZClassMemoryInfo>& Pair : ClassMemory)
     {
-        Statistics.PeakConcurrentUsage = TotalObjects;
+        if (Pair.Value.ObjectCount > 0 && (!StalestInfo || Pair.Value.MeasuredTime < StalestInfo->MeasuredTime))
+        {
+            StalestClass = Pair.Key;
+            StalestInfo = &Pair.Value;
+        }
     }
 
-    // Calculate hit rate
-    Statistics.CalculateHitRate();
-
-    // Calculate memory usage if monitoring is enabled
-    if (Config.bEnableMonitoring)
+    if (!StalestInfo || Now - StalestInfo->MeasuredTime < Config.MemoryRefreshIntervalSeconds)
     {
-        CalculateMemoryUsage();
+        return false;
     }
-}
-
-void UGWIZObjectPool::CalculateMemoryUsage()
-{
-    int64 TotalMemory = 0;
 
-    // Calculate memory for available objects
-    for (UObject* Object : AvailableObjects)
+    const UObject* Sample = nullptr;
+    for (const FGWIZPoolSlot& Slot : Slots)
     {
-        if (Object)
+        if (Slot.Object && Slot.Object->GetClass() == StalestClass)
         {
-            TotalMemory += Object->GetClass()->GetPropertiesSize();
+            Sample = Slot.Object;
+            break;
         }
     }
 
-    // Calculate memory for objects in use
-    for (UObject* Object : ObjectsInUse)
+    StalestInfo->MeasuredTime = Now;
+    if (!Sample)
     {
-        if (Object)
-        {
-            TotalMemory += Object->GetClass()->GetPropertiesSize();
-        }
+        return false;
+    }
+
+    const int64 NewSize = MeasureObjectMemory(Sample);
+    TrackedMemoryUsage += (NewSize - StalestInfo->ObjectSize) * StalestInfo->ObjectCount;
+    StalestInfo->ObjectSize = NewSize;
+
+    if (Config.bEnableMonitoring)
+    {
+        Statistics.MemoryUsage = TrackedMemoryUsage;
     }
 
-    Statistics.MemoryUsage = TotalMemory;
+    LogDebug(FString::Printf(TEXT("RefreshMemoryMeasurement: %s measured at %lld bytes per instance"), *StalestClass->GetName(), NewSize));
+    return true;
 }
 
 void UGWIZObjectPool::LogDebug(const FString& Message)
@@ -378,25 +1897,28 @@ void UGWIZObjectPool::InitializePool()
         return;
     }
 
+    UpdateThreadingMode();
+
     // Create initial objects
     for (int32 i = 0; i < Config.InitialPoolSize; ++i)
     {
         UObject* Object = CreateNewObject();
         if (Object)
         {
-            AvailableObjects.Add(Object);
+            AddIdleObject(Object);
         }
     }
 
     bIsInitialized = true;
     UpdateStatistics();
     
-    LogDebug(FString::Printf(TEXT("InitializePool: Initialized with %d objects"), AvailableObjects.Num()));
+    LogDebug(FString::Printf(TEXT("InitializePool: Initialized with %d objects"), GetAvailableCount()));
 }
 
 void UGWIZObjectPool::ConfigurePool(const FGWIZPoolConfig& NewConfig)
 {
     Config = NewConfig;
+    UpdateThreadingMode();
     LogDebug(TEXT("ConfigurePool: Configuration updated"));
 }
 
@@ -407,12 +1929,164 @@ void UGWIZObjectPool::ShrinkToMinimum()
         return;
     }
 
-    // Remove excess objects beyond minimum size
-    while (AvailableObjects.Num() > Config.MinPoolSize)
+    TrimIdleObjects(Config.MinPoolSize);
+    LogDebug(FString::Printf(TEXT("ShrinkToMinimum: Shrunk to %d objects"), GetAvailableCount()));
+}
+
+int32 UGWIZObjectPool::TrimIdleObjects(int32 TargetAvailable)
+{
+    int32 Removed = 0;
+
+    if (bThreadSafeMode)
+    {
+        ReclaimThreadCaches();
+
+        FScopeLock Lock(&PoolMutex);
+        while (GetAvailableCount() > TargetAvailable)
+        {
+            UObject* Object = ConcurrentFreeList.Pop();
+            if (!Object)
+            {
+                break;
+            }
+            ConcurrentAvailable.fetch_sub(1, std::memory_order_relaxed);
+            RetireSlot(FindSlot(Object));
+            ++Removed;
+        }
+    }
+
+    while (AvailableSlots.Num() > TargetAvailable)
     {
-        AvailableObjects.Pop();
+        const int32 SlotIndex = AvailableSlots.Last();
+        UnlinkSlot(SlotIndex);
+        RetireSlot(SlotIndex);
+        ++Removed;
     }
 
     UpdateStatistics();
-    LogDebug(FString::Printf(TEXT("ShrinkToMinimum: Shrunk to %d objects"), AvailableObjects.Num()));
+    return Removed;
+}
+
+int64 UGWIZObjectPool::EvictIdleMemory(int64 BytesToFree, int32 KeepAvailable)
+{
+    const int32 Available = GetAvailableCount();
+    const int32 TotalObjects = Available + GetInUseCount();
+    if (BytesToFree <= 0 || Available <= KeepAvailable || TotalObjects == 0 || TrackedMemoryUsage <= 0)
+    {
+        return 0;
+    }
+
+    const int64 AverageSize = FMath::Max<int64>(1, TrackedMemoryUsage / TotalObjects);
+    const int32 Count = static_cast<int32>(FMath::Min<int64>(Available - KeepAvailable, FMath::DivideAndRoundUp(BytesToFree, AverageSize)));
+
+    const int64 MemoryBefore = TrackedMemoryUsage;
+    const int32 Removed = TrimIdleObjects(Available - Count);
+
+    LogDebug(FString::Printf(TEXT("EvictIdleMemory: Removed %d objects, freed %lld bytes"), Removed, MemoryBefore - TrackedMemoryUsage));
+    return MemoryBefore - TrackedMemoryUsage;
+}
+
+bool UGWIZObjectPool::EvaluateAdaptiveSize(double Now, FGWIZResizeDecision& OutDecision, bool bAllowGrow)
+{
+    if (!Config.bEnableAdaptiveSizing || !bIsInitialized)
+    {
+        return false;
+    }
+
+    FGWIZAdaptiveSizingState& State = AdaptiveState;
+    const int32 InUse = GetInUseCount();
+    const int32 Available = GetAvailableCount();
+    const int32 Total = InUse + Available;
+    const int32 Misses = bThreadSafeMode ? ConcurrentMisses.load(std::memory_order_relaxed) : Statistics.PoolMisses;
+
+    // Close the current sample, then drop samples that have left the window (always keeping the newest)
+    FGWIZUsageSample NewSample;
+    NewSample.Time = Now;
+    NewSample.PeakInUse = FMath::Max(State.PeakInUseSinceSample, InUse);
+    NewSample.Misses = FMath::Max(0, Misses - State.MissesAtLastSample);
+    State.PeakInUseSinceSample = InUse;
+    State.MissesAtLastSample = Misses;
+
+    const int32 PreviousPeak = State.Samples.Num() > 0 ? State.Samples.Last().PeakInUse : NewSample.PeakInUse;
+    State.Samples.Add(NewSample);
+
+    const double WindowStart = Now - Config.AdaptiveWindowSeconds;
+    int32 Expired = 0;
+    while (Expired < State.Samples.Num() - 1 && State.Samples[Expired].Time < WindowStart)
+    {
+        ++Expired;
+    }
+    if (Expired > 0)
+    {
+        State.Samples.RemoveAt(0, Expired, EAllowShrinking::No);
+    }
+
+    int32 WindowPeak = 0;
+    int32 WindowMisses = 0;
+    for (const FGWIZUsageSample& Sample : State.Samples)
+    {
+        WindowPeak = FMath::Max(WindowPeak, Sample.PeakInUse);
+        WindowMisses += Sample.Misses;
+    }
+
+    // While usage is rising, provision for one more sample of the same rise
+    const int32 Rise = NewSample.PeakInUse - PreviousPeak;
+    const int32 ExpectedPeak = Rise > 0 ? FMath::Max(WindowPeak, NewSample.PeakInUse + Rise) : WindowPeak;
+
+    const int32 GrowTarget = FMath::Clamp(FMath::CeilToInt(ExpectedPeak * (1.0f + Config.AdaptiveHeadroom)), Config.MinPoolSize, Config.MaxPoolSize);
+    const int32 ShrinkThreshold = FMath::CeilToInt(WindowPeak * (1.0f + 2.0f * Config.AdaptiveHeadroom));
+
+    OutDecision.CurrentTotal = Total;
+    OutDecision.InUse = InUse;
+    OutDecision.WindowPeak = WindowPeak;
+    OutDecision.WindowMisses = WindowMisses;
+    OutDecision.OverProvisionedSeconds = 0.0;
+
+    if (Total < GrowTarget)
+    {
+        State.OverProvisionedSince = -1.0;
+
+        // Nothing is recorded for a refused grow, so the pending check below cannot suppress it later
+        if (!bAllowGrow)
+        {
+            LogDebug(FString::Printf(TEXT("EvaluateAdaptiveSize: Grow from %d to %d not allowed"), Total, GrowTarget));
+            return false;
+        }
+
+        // A grow that is still being filled is not decided again unless demand rose further
+        if (State.PendingGrowTarget >= GrowTarget)
+        {
+            return false;
+        }
+
+        State.PendingGrowTarget = GrowTarget;
+        OutDecision.TargetTotal = GrowTarget;
+        return true;
+    }
+
+    State.PendingGrowTarget = INDEX_NONE;
+
+    if (Total <= ShrinkThreshold || WindowMisses > 0)
+    {
+        State.OverProvisionedSince = -1.0;
+        return false;
+    }
+
+    if (State.OverProvisionedSince < 0.0)
+    {
+        State.OverProvisionedSince = Now;
+    }
+
+    const double OverProvisionedSeconds = Now - State.OverProvisionedSince;
+    const int32 TargetAvailable = FMath::Max(GrowTarget - InUse, Config.MinPoolSize);
+    if (OverProvisionedSeconds < Config.AdaptiveShrinkDelaySeconds || TargetAvailable >= Available)
+    {
+        return false;
+    }
+
+    // Restart the idle timer so a further shrink needs another full delay
+    State.OverProvisionedSince = -1.0;
+    OutDecision.TargetTotal = InUse + TargetAvailable;
+    OutDecision.OverProvisionedSeconds = OverProvisionedSeconds;
+    return true;
 }
@@ -4,10 +4,20 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "Containers/LockFreeList.h"
 #include "PoolingTypes.h"
 #include "IGWIZPoolable.h"
+#include <atomic>
 #include "GWIZObjectPool.generated.h"
 
+class AActor;
+
+/** Statically bound lifecycle callback that replaces IGWIZPoolable dispatch for one checkout or return */
+using FGWIZLifecycleHook = void (*)(UObject*);
+
+/** Fired when a pool's destroy queue goes from empty to non-empty */
+DECLARE_DELEGATE_OneParam(FGWIZOnDestroyQueued, class UGWIZObjectPool*);
+
 /**
  * Individual object pool for a specific object type.
  * Manages object lifecycle, statistics, and pool operations.
@@ -37,12 +47,70 @@ public:
     UObject* GetObject(TSubclassOf<UObject> ObjectClass);
 
     /**
-     * Return object to pool for reuse.
+     * Get object from pool together with a handle that identifies this checkout.
+     * @param ObjectClass Class of object to get
+     * @param OutHandle Handle for the checked out object (reset if no object was returned)
+     * @return Object from pool or newly created object
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    UObject* GetObjectWithHandle(TSubclassOf<UObject> ObjectClass, FGWIZPoolHandle& OutHandle);
+
+    /**
+     * Get several objects from the pool with a single statistics update.
+     * @param ObjectClass Class of objects to get
+     * @param Count Number of objects to get
+     * @param OutObjects Array the objects are appended to
+     * @return Number of objects appended
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    int32 GetObjects(TSubclassOf<UObject> ObjectClass, int32 Count, TArray<UObject*>& OutObjects);
+
+    /**
+     * Return object to pool for reuse. Objects that are already in the pool are rejected.
      * @param Object Object to return to pool
      */
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
     void ReturnObject(UObject* Object);
 
+    /**
+     * Return several objects to the pool with a single statistics update.
+     * @param Objects Objects to return
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    void ReturnObjects(const TArray<UObject*>& Objects);
+
+    /**
+     * Return the object identified by a handle. Stale handles are rejected in constant time.
+     * @param Handle Handle obtained from GetObjectWithHandle
+     * @return true if the object was returned, false if the handle was stale
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    bool ReturnObjectByHandle(const FGWIZPoolHandle& Handle);
+
+    /**
+     * Check if a handle still refers to a checked out object.
+     * @param Handle Handle to validate
+     * @return true if the handle is current, false if it is stale or unset
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    bool IsHandleValid(const FGWIZPoolHandle& Handle) const;
+
+    /**
+     * Get the object a handle refers to.
+     * @param Handle Handle to resolve
+     * @return Object for the handle, or nullptr if the handle is stale
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    UObject* ResolveHandle(const FGWIZPoolHandle& Handle) const;
+
+    /**
+     * Get the current handle for an object that is checked out of this pool.
+     * @param Object Object to look up
+     * @return Handle for the object, or an unset handle if it is not in use
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    FGWIZPoolHandle GetHandleForObject(const UObject* Object) const;
+
     /**
      * Add object to pool manually.
      * @param Object Object to add to pool
@@ -70,6 +138,23 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
     void PreWarmPool(int32 Count);
 
+    /**
+     * Pre-warm pool towards a target count, stopping once the deadline has passed.
+     * At least one object is created per call if any are missing.
+     * @param Count Number of available objects to reach
+     * @param DeadlineSeconds Platform time (FPlatformTime::Seconds) at which to stop
+     * @return Number of objects created by this call
+     */
+    int32 PreWarmPoolUntil(int32 Count, double DeadlineSeconds);
+
+    /**
+     * Get how many objects are still missing to pre-warm the pool to a target count.
+     * @param Count Number of available objects to reach
+     * @return Objects still to create, clamped by MaxPoolSize
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    int32 GetPreWarmDeficit(int32 Count) const;
+
     /**
      * Get current pool statistics.
      * @return Copy of current statistics
@@ -84,12 +169,21 @@ public:
     void PrintDebugInfo();
 
     /**
-     * Get memory usage information.
+     * Get memory usage information: the measured size of every owned object, components and subobjects included.
      * @return Memory usage in bytes
      */
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
     int64 GetMemoryUsage() const;
 
+    /**
+     * Re-measure the pooled class whose measurement is oldest, if it is older than Config.MemoryRefreshIntervalSeconds,
+     * and adjust the memory total for every instance of it. At most one object is walked per call.
+     * AGWIZPoolingManager calls this periodically while performance monitoring is enabled.
+     * @param Now Current time in seconds
+     * @return true if a class was re-measured
+     */
+    bool RefreshMemoryMeasurement(double Now);
+
     /**
      * Validate pool integrity and consistency.
      * @return true if pool is valid, false otherwise
@@ -111,6 +205,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
     int32 GetObjectsInUse() const;
 
+    /**
+     * Check if an object is currently checked out of this pool.
+     * @param Object Object to check
+     * @return true if the object belongs to this pool and is in use
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    bool IsObjectInUse(const UObject* Object) const;
+
+    /**
+     * Check if an object belongs to this pool, whether available or in use.
+     * @param Object Object to check
+     * @return true if the pool owns the object
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    bool ContainsObject(const UObject* Object) const;
+
     /**
      * Check if pool is empty (no available objects).
      * @return true if pool is empty, false otherwise
@@ -132,11 +242,32 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
     TSubclassOf<UObject> GetPooledObjectClass() const { return PooledObjectClass; }
 
+    /**
+     * Get the pool that created an object without any lookup. Plain UObjects are created with their pool
+     * as Outer, so the outer is the back-pointer; actors are outered to their level and return nullptr.
+     * @param Object Object to inspect
+     * @return Owning pool, or nullptr if the object was not created by a pool or is an actor
+     */
+    static UGWIZObjectPool* GetOwningPool(const UObject* Object)
+    {
+        return Object ? Cast<UGWIZObjectPool>(Object->GetOuter()) : nullptr;
+    }
+
     /**
      * Set the class type this pool manages.
      * @param ObjectClass Class type to set
      */
-    void SetPooledObjectClass(TSubclassOf<UObject> ObjectClass) { PooledObjectClass = ObjectClass; }
+    void SetPooledObjectClass(TSubclassOf<UObject> ObjectClass);
+
+    /**
+     * Check if the pool runs in thread-safe mode.
+     * Enabled by Config.bEnableThreadSafety for non-actor classes; latched while the pool owns no objects.
+     * In this mode GetObject/ReturnObject may be called from any thread, but a miss off the game thread returns nullptr,
+     * handles are not issued, double returns are not detected and only native IGWIZPoolable callbacks run.
+     * @return true if the pool uses the lock-free free list
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    bool IsThreadSafe() const { return bThreadSafeMode; }
 
     /**
      * Initialize the pool with initial objects.
@@ -164,6 +295,62 @@ public:
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
     void ShrinkToMinimum();
 
+    /**
+     * Remove idle objects until at most TargetAvailable remain.
+     * @param TargetAvailable Number of idle objects to keep
+     * @return Number of objects removed
+     */
+    int32 TrimIdleObjects(int32 TargetAvailable);
+
+    /**
+     * Remove idle objects until roughly BytesToFree of measured memory has been released.
+     * Uses the pool's average object size, so a pool of mixed classes may free slightly more or less.
+     * Removed objects go through the budgeted destroy queue like any other trim.
+     * @param BytesToFree Memory to release
+     * @param KeepAvailable Number of idle objects that must remain
+     * @return Bytes of measured memory released
+     */
+    int64 EvictIdleMemory(int64 BytesToFree, int32 KeepAvailable);
+
+    /**
+     * Destroy objects the pool has let go of (surplus returns and trimmed idle objects) until the deadline passes.
+     * Actors are destroyed and other objects are marked as garbage. At least one object is destroyed per call.
+     * Surplus handed over by other threads in thread-safe mode joins the queue first. Game thread only.
+     * AGWIZPoolingManager drains every pool's queue within DestroyFrameBudgetMs each frame.
+     * @param DeadlineSeconds FPlatformTime::Seconds() value to stop at
+     * @return Number of objects destroyed
+     */
+    int32 ProcessPendingDestroy(double DeadlineSeconds);
+
+    /** Number of objects waiting to be destroyed, including surplus not yet handed to the game thread */
+    int32 GetPendingDestroyCount() const { return PendingDestroy.Num() + ConcurrentSurplusCount.load(std::memory_order_relaxed); }
+
+    /**
+     * Bound by the owning AGWIZPoolingManager so it only visits pools that have destroy work.
+     * In thread-safe mode this can fire on the thread that returned a surplus object.
+     */
+    FGWIZOnDestroyQueued OnDestroyQueued;
+
+    /**
+     * Number of acquires served so far (hits plus misses), without building full statistics.
+     * Compare two readings to tell whether the pool was used in between, even if every object is back.
+     */
+    int32 GetAcquireCount() const;
+
+    /**
+     * Record a usage sample and decide whether the pool should be resized.
+     * The pool grows as soon as it owns fewer objects than the window's peak usage plus headroom (projected one
+     * sample ahead while usage is rising). It shrinks only after staying above peak plus twice the headroom, with
+     * no misses, for AdaptiveShrinkDelaySeconds; the gap between the two thresholds keeps it from thrashing.
+     * Called periodically by AGWIZPoolingManager; does nothing unless Config.bEnableAdaptiveSizing is set.
+     * @param Now Current time in seconds
+     * @param OutDecision Filled in when a resize is wanted
+     * @param bAllowGrow false while the caller will not grow the pool (e.g. over a memory budget); a refused grow
+     *        is not remembered, so it is decided again once growing is allowed
+     * @return true if the pool should be resized to OutDecision.TargetTotal
+     */
+    bool EvaluateAdaptiveSize(double Now, FGWIZResizeDecision& OutDecision, bool bAllowGrow = true);
+
     /**
      * Get object from pool (alias for GetObject).
      * @return Object from pool or newly created object
@@ -183,18 +370,82 @@ public:
      * @return Current number of objects in the pool
      */
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
-    int32 GetCurrentPoolSize() const { return AvailableObjects.Num(); }
+    int32 GetCurrentPoolSize() const { return GetAvailableCount(); }
+
+    /**
+     * Call IGWIZPoolable::OnPooled on an object using this pool's per-class dispatch cache.
+     * Does nothing if the object does not implement the interface.
+     * @param Object Object to notify
+     */
+    void DispatchOnPooled(UObject* Object);
+
+    /**
+     * Call IGWIZPoolable::OnUnpooled on an object using this pool's per-class dispatch cache.
+     * Does nothing if the object does not implement the interface.
+     * @param Object Object to notify
+     */
+    void DispatchOnUnpooled(UObject* Object);
+
+    /**
+     * GetObjectWithHandle for C++ callers that bind their lifecycle callback at compile time.
+     * When the InterfaceCallbacks step is enabled, OnPooledHook runs in place of IGWIZPoolable::OnPooled.
+     * @param ObjectClass Class of object to get
+     * @param OutHandle Handle for the checked out object (reset if no object was returned)
+     * @param OnPooledHook Callback to run instead of interface dispatch, or nullptr for the default
+     * @return Object from pool or newly created object
+     */
+    UObject* GetObjectWithHook(TSubclassOf<UObject> ObjectClass, FGWIZPoolHandle& OutHandle, FGWIZLifecycleHook OnPooledHook);
+
+    /**
+     * ReturnObject for C++ callers that bind their lifecycle callback at compile time.
+     * When the InterfaceCallbacks step is enabled, OnUnpooledHook runs in place of IGWIZPoolable::OnUnpooled.
+     * @param Object Object to return to pool
+     * @param OnUnpooledHook Callback to run instead of interface dispatch, or nullptr for the default
+     * @return false if the object was rejected
+     */
+    bool ReturnObjectWithHook(UObject* Object, FGWIZLifecycleHook OnUnpooledHook);
+
+    /**
+     * ReturnObjectByHandle for C++ callers that bind their lifecycle callback at compile time.
+     * @param Handle Handle obtained from GetObjectWithHandle or GetObjectWithHook
+     * @param OnUnpooledHook Callback to run instead of interface dispatch, or nullptr for the default
+     * @return true if the object was returned, false if the handle was stale
+     */
+    bool ReturnObjectByHandleWithHook(const FGWIZPoolHandle& Handle, FGWIZLifecycleHook OnUnpooledHook);
 
 
 
 protected:
-    /** Array of available objects in the pool */
+    /** Every object owned by the pool, indexed by slot */
     UPROPERTY()
-    TArray<UObject*> AvailableObjects;
+    TArray<FGWIZPoolSlot> Slots;
 
-    /** Array of objects currently in use */
-    UPROPERTY()
-    TArray<UObject*> ObjectsInUse;
+    /** Slot indices of objects available for checkout (used as a stack) */
+    TArray<int32> AvailableSlots;
+
+    /** Slot indices of objects currently in use (dense set, swap-removed on return) */
+    TArray<int32> InUseSlots;
+
+    /** Slot indices whose object has left the pool and can be reused */
+    TArray<int32> VacantSlots;
+
+    /** Reverse lookup from object to its slot index */
+    TMap<const UObject*, int32> SlotLookup;
+
+    /** Memory figures per class of owned object, used for delta memory accounting */
+    TMap<const UClass*, FGWIZClassMemoryInfo> ClassMemory;
+
+    /** Running total of memory owned by the pool, maintained by AllocateSlot/ReleaseSlot */
+    int64 TrackedMemoryUsage;
+
+    /** Objects released by the pool that still have to be destroyed */
+    TArray<TWeakObjectPtr<UObject>> PendingDestroy;
+
+    /** Checkout durations of returned objects (slot path only; thread-safe mode does not time checkouts) */
+    FGWIZLifetimeHistogram LifetimeHistogram;
+
+    /** Sliding-window usage samples for EvaluateAdaptiveSize */
+    FGWIZAdaptiveSizingState AdaptiveState;
 
     /** Class type this pool manages */
     UPROPERTY()
@@ -204,36 +455,296 @@ protected:
     UPROPERTY()
     bool bIsInitialized;
 
-    /** Thread safety mutex */
-    FCriticalSection PoolMutex;
+    /** Guards slot bookkeeping in thread-safe mode; the hot path only takes it for objects the pool did not create */
+    mutable FCriticalSection PoolMutex;
+
+    /** Whether the lock-free path is in use (see IsThreadSafe) */
+    bool bThreadSafeMode;
+
+    /** Free objects shared between threads (thread-safe mode only). Slots keep these objects alive. */
+    TLockFreePointerListUnordered<UObject, PLATFORM_CACHE_LINE_SIZE> ConcurrentFreeList;
+
+    /** Counters maintained by the lock-free path and published to Statistics on the game thread */
+    std::atomic<int32> ConcurrentAvailable;
+    std::atomic<int32> ConcurrentInUse;
+    std::atomic<int32> ConcurrentHits;
+    std::atomic<int32> ConcurrentMisses;
+
+    /** Returns beyond MaxPoolSize on the lock-free path, waiting for the game thread to queue them for destruction */
+    TLockFreePointerListUnordered<UObject, PLATFORM_CACHE_LINE_SIZE> ConcurrentSurplus;
+    std::atomic<int32> ConcurrentSurplusCount;
+
+    /** Which owned objects are checked out, so a second ReleaseConcurrent of the same object is rejected */
+    FGWIZConcurrentCheckoutFlags ConcurrentCheckouts;
+
+    /** Lifecycle of PooledObjectClass, resolved on the game thread when thread-safe mode is latched */
+    const FGWIZClassLifecycle* ConcurrentLifecycle;
+
+    /** Magazine size latched with thread-safe mode (0 when per-thread caches are off) */
+    int32 MagazineSize;
+
+    /** Unique id used to find this pool's cache in each thread's cache table; never reused */
+    uint64 PoolSerial;
+
+    /** Full magazines waiting to be picked up by a thread; their objects count as ConcurrentAvailable */
+    TLockFreePointerListUnordered<FGWIZObjectMagazine, PLATFORM_CACHE_LINE_SIZE> FullMagazines;
+
+    /** Emptied magazines kept for reuse */
+    TLockFreePointerListUnordered<FGWIZObjectMagazine, PLATFORM_CACHE_LINE_SIZE> EmptyMagazines;
+
+    /** Owns every magazine and thread cache created by this pool (guarded by PoolMutex) */
+    TArray<TUniquePtr<FGWIZObjectMagazine>> AllMagazines;
+    TArray<TUniquePtr<FGWIZThreadCache>> ThreadCaches;
 
     /**
-     * Create new object instance.
+     * Get the calling thread's cache for this pool, creating it on first use.
+     * @return Thread cache
+     */
+    FGWIZThreadCache& GetThreadCache();
+
+    /**
+     * Move a magazine's worth of objects from the shared pool into a thread cache.
+     * @param Cache Calling thread's cache
+     */
+    void RefillThreadCache(FGWIZThreadCache& Cache);
+
+    /**
+     * Move one magazine of objects from a thread cache to the shared depot.
+     * @param Cache Calling thread's cache
+     */
+    void FlushThreadCache(FGWIZThreadCache& Cache);
+
+    /**
+     * Pull every cached and depot object back into the shared free list.
+     * Game thread only, while no worker is using the pool.
+     */
+    void ReclaimThreadCaches();
+
+    /**
+     * Choose between the single-threaded and lock-free paths from the current config and class.
+     * Does nothing once the pool owns objects.
+     */
+    void UpdateThreadingMode();
+
+    /**
+     * Take an object from the lock-free free list, creating one on a miss if called on the game thread.
+     * @param OnPooledHook Callback to run instead of native interface dispatch, or nullptr
+     * @return Object, or nullptr on a miss off the game thread
+     */
+    UObject* AcquireConcurrent(FGWIZLifecycleHook OnPooledHook = nullptr);
+
+    /**
+     * Push an object back onto the lock-free free list.
+     * @param Object Object to return
+     * @param OnUnpooledHook Callback to run instead of native interface dispatch, or nullptr
+     * @return true if the object was accepted
+     */
+    bool ReleaseConcurrent(UObject* Object, FGWIZLifecycleHook OnUnpooledHook = nullptr);
+
+    /** Number of objects available for checkout in either mode, including per-thread caches */
+    int32 GetAvailableCount() const
+    {
+        return bThreadSafeMode ? GetConcurrentAvailableCount() : AvailableSlots.Num();
+    }
+
+    /** Number of objects checked out in either mode */
+    int32 GetInUseCount() const
+    {
+        return bThreadSafeMode ? GetConcurrentInUseCount() : InUseSlots.Num();
+    }
+
+    /** Shared available count plus objects held in thread caches */
+    int32 GetConcurrentAvailableCount() const;
+
+    /** Shared in-use count plus net checkouts through thread caches */
+    int32 GetConcurrentInUseCount() const;
+
+    /**
+     * Copy the lock-free counters into a statistics struct.
+     * @param OutStats Statistics to fill
+     */
+    void ReadConcurrentCounters(FGWIZPoolStatistics& OutStats) const;
+
+    /**
+     * Fill in lifetime percentiles from the histogram and the age of the oldest checked out object.
+     * Walks the in-use list, so it runs on demand rather than on every operation.
+     * @param OutStats Statistics to fill
+     */
+    void ReadLifetimeStatistics(FGWIZPoolStatistics& OutStats) const;
+
+    /**
+     * Create new object instance. Actor classes are spawned into the world of the pool's outer.
      * @return Newly created object
      */
     UObject* CreateNewObject();
 
     /**
-     * Initialize object for use (call OnPooled).
-     * @param Object Object to initialize
+     * Spawn an actor of the pooled class into the pool's world with deferred construction,
+     * finishing the spawn with the actor hidden, collision disabled and tick off.
+     * @return Newly spawned dormant actor, or nullptr if the pool has no world
+     */
+    AActor* SpawnDormantActor();
+
+    /**
+     * Store an object in a free slot. The slot is not placed in any list.
+     * @param Object Object to store
+     * @return Index of the slot holding the object
+     */
+    int32 AllocateSlot(UObject* Object);
+
+    /**
+     * Release a slot so its index can be reused. The slot must not be in any list.
+     * @param SlotIndex Slot to release
+     */
+    void ReleaseSlot(int32 SlotIndex);
+
+    /**
+     * Release a slot and queue its object for budgeted destruction. The slot must not be in any list.
+     * @param SlotIndex Slot to retire
+     */
+    void RetireSlot(int32 SlotIndex);
+
+    /**
+     * Advance a slot's generation so handles issued for it become stale.
+     * @param SlotIndex Slot to advance
+     */
+    void BumpGeneration(int32 SlotIndex);
+
+    /**
+     * Take an available slot, or create a new object, and mark it in use. Does not update statistics.
+     * @param bOutWasHit Set to true if an existing object was reused
+     * @param OnPooledHook Passed through to InitializeObject
+     * @return Slot index of the checked out object, or INDEX_NONE if creation failed
+     */
+    int32 CheckoutSlot(bool& bOutWasHit, FGWIZLifecycleHook OnPooledHook = nullptr);
+
+    /**
+     * Return an in-use slot: clean up its object, then keep it or release it depending on capacity.
+     * Does not update statistics.
+     * @param SlotIndex Slot to return
+     * @param OnUnpooledHook Passed through to CleanupObject
+     */
+    void CheckinSlot(int32 SlotIndex, FGWIZLifecycleHook OnUnpooledHook = nullptr);
+
+    /**
+     * Find the slot holding an object.
+     * @param Object Object to look up
+     * @return Slot index, or INDEX_NONE if the object does not belong to this pool
      */
-    void InitializeObject(UObject* Object);
+    int32 FindSlot(const UObject* Object) const;
 
     /**
-     * Clean up object for pooling (call OnUnpooled).
-     * @param Object Object to clean up
+     * Append a slot to the available or in-use list.
+     * @param SlotIndex Slot to add
+     * @param bInUse Whether to add to the in-use list instead of the available list
      */
-    void CleanupObject(UObject* Object);
+    void LinkSlot(int32 SlotIndex, bool bInUse);
 
     /**
-     * Update pool statistics.
+     * Remove a slot from whichever list it is in, in constant time.
+     * @param SlotIndex Slot to remove
+     */
+    void UnlinkSlot(int32 SlotIndex);
+
+    /** Lifecycle dispatch resolved per class of pooled object */
+    TMap<const UClass*, TUniquePtr<FGWIZClassLifecycle>> ClassLifecycles;
+
+    /** Most recently used entry of ClassLifecycles, checked before the map */
+    const UClass* LastLifecycleClass = nullptr;
+    FGWIZClassLifecycle* LastLifecycle = nullptr;
+
+    /**
+     * Get the cached lifecycle dispatch for a class, resolving it on first use.
+     * @param ObjectClass Class of a pooled object
+     * @return Cached lifecycle information
+     */
+    FGWIZClassLifecycle& GetClassLifecycle(const UClass* ObjectClass);
+
+    /**
+     * Build the component profile for an actor class from one of its instances.
+     * Records only components that need work on checkout or return.
+     * @param Actor Instance to inspect
+     * @param Lifecycle Lifecycle entry for the actor's class
+     */
+    void BuildComponentProfile(const AActor* Actor, FGWIZClassLifecycle& Lifecycle);
+
+    /**
+     * Get a slot's profiled components, resolving them against its actor the first time.
+     * @param Slot Slot holding an actor
+     * @param Lifecycle Lifecycle entry for the actor's class
+     * @return Components in profile order (entries may be null if the actor lacks a component)
+     */
+    const TArray<TWeakObjectPtr<UActorComponent>>& GetSlotComponents(FGWIZPoolSlot& Slot, FGWIZClassLifecycle& Lifecycle);
+
+    /**
+     * Give a newly created object a slot in the available list, deep parking it if configured.
+     * @param Object Newly created object
+     * @return Slot index
+     */
+    int32 AddIdleObject(UObject* Object);
+
+    /**
+     * Unregister an idle actor's profiled components, removing it from the scene, physics and tick lists.
+     * @param Slot Slot holding an actor
+     */
+    void DeepParkSlot(FGWIZPoolSlot& Slot);
+
+    /**
+     * Re-register the components unregistered by DeepParkSlot.
+     * @param Slot Slot holding a deep parked actor
+     */
+    void UnparkSlot(FGWIZPoolSlot& Slot);
+
+    /**
+     * Work out how a class receives lifecycle callbacks. Uses reflection; called once per class.
+     * @param ObjectClass Class to inspect
+     * @return Resolved lifecycle information
+     */
+    FGWIZClassLifecycle ResolveClassLifecycle(const UClass* ObjectClass);
+
+    /** Invoke OnPooled using resolved lifecycle information */
+    static void DispatchOnPooled(UObject* Object, const FGWIZClassLifecycle& Lifecycle);
+
+    /** Invoke OnUnpooled using resolved lifecycle information */
+    static void DispatchOnUnpooled(UObject* Object, const FGWIZClassLifecycle& Lifecycle);
+
+    /**
+     * Run the activation steps enabled in Config.ActivationSteps on a checked-out object.
+     * This is the only place checkout lifecycle work happens.
+     * @param SlotIndex Slot holding the object to initialize
+     * @param OnPooledHook Callback for the InterfaceCallbacks step, or nullptr to dispatch through IGWIZPoolable
+     */
+    void InitializeObject(int32 SlotIndex, FGWIZLifecycleHook OnPooledHook = nullptr);
+
+    /**
+     * Run the deactivation steps enabled in Config.ActivationSteps on a returned object.
+     * This is the only place return lifecycle work happens.
+     * @param SlotIndex Slot holding the object to clean up
+     * @param OnUnpooledHook Callback for the InterfaceCallbacks step, or nullptr to dispatch through IGWIZPoolable
+     */
+    void CleanupObject(int32 SlotIndex, FGWIZLifecycleHook OnUnpooledHook = nullptr);
+
+    /**
+     * Update pool statistics. Runs in constant time regardless of pool size.
      */
     void UpdateStatistics();
 
     /**
-     * Calculate memory usage of pool.
+     * Add or remove an object's contribution to the tracked memory total.
+     * Instance sizes are cached per class, so only the first object of a class is measured;
+     * RefreshMemoryMeasurement keeps the cached size current.
+     * @param Object Object entering or leaving the pool
+     * @param CountDelta +1 when the object enters the pool, -1 when it leaves
+     */
+    void TrackObjectMemory(const UObject* Object, int32 CountDelta);
+
+    /**
+     * Measure an object with the engine's resource-size reporting (EstimatedTotal), adding its subobjects.
+     * Covers heap allocations and render resources that objects report, not just reflected properties.
+     * @param Object Object to measure
+     * @return Size in bytes
      */
-    void CalculateMemoryUsage();
+    static int64 MeasureObjectMemory(const UObject* Object);
 
     /**
      * Log debug information if enabled.
@@ -2,15 +2,14 @@
 // This code is part of the GWIZ Generic Pooling System for Unreal Engine.
 
 #include "GWIZPoolingManager.h"
+#include "GWIZPoolingSubsystem.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "GameFramework/GameModeBase.h"
-#include "Kismet/GameplayStatics.h"
 #include "HAL/CriticalSection.h"
-
-// Static instance for global access
-static AGWIZPoolingManager* GGlobalPoolingManager = nullptr;
-static FCriticalSection GGlobalPoolingManagerMutex;
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeRWLock.h"
+#include "Algo/BinarySearch.h"
 
 // Sets default values
 AGWIZPoolingManager::AGWIZPoolingManager()
@@ -26,12 +25,17 @@ void AGWIZPoolingManager::BeginPlay()
     
     // Initialize default configuration
     DefaultConfig = FGWIZPoolConfig();
+}
+
+void AGWIZPoolingManager::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
     
-    // Register as global instance if not already set
-    FScopeLock Lock(&GGlobalPoolingManagerMutex);
-    if (GGlobalPoolingManager == nullptr)
+    // Register with the world, whether placed in the level or spawned by the subsystem; runs before BeginPlay
+    // so managers in worlds that never begin play (tests, tools) are found too
+    if (UGWIZPoolingSubsystem* Subsystem = UWorld::GetSubsystem<UGWIZPoolingSubsystem>(GetWorld()))
     {
-        GGlobalPoolingManager = this;
+        Subsystem->RegisterManager(this);
     }
 }
 
@@ -40,30 +44,27 @@ void AGWIZPoolingManager::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
     
-    // Only run expensive operations occasionally
-    static float TimeAccumulator = 0.0f;
-    TimeAccumulator += DeltaTime;
-    
-    // Update every 0.5 seconds instead of every frame
-    if (TimeAccumulator >= 0.5f)
+    // Time-sliced pre-warming runs every frame while work is queued
+    if (PreWarmQueue.Num() > 0)
     {
-        TimeAccumulator = 0.0f;
-        
-        if (bEnablePerformanceMonitoring)
-        {
-            // TODO: Implement performance metrics update
-        }
-        
-        if (bEnableAutoCleanup)
-        {
-            // TODO: Implement auto cleanup
-        }
+        ProcessPreWarmQueue();
     }
     
-    // Debug display updates every frame (if enabled)
-    if (bEnableDebugMode)
+    // Surplus objects are destroyed a few at a time so a large shrink never hitches
+    ProcessPendingDestroys();
+    
+    // Pools are maintained a few at a time, so the cost per frame does not grow with the pool count
+    RunMaintenance();
+    
+    // Budgets span every pool, so they are checked on an interval rather than per visit
+    if (MemoryBudgetBytes > 0 || CategoryMemoryBudgets.Num() > 0)
     {
-        // TODO: Implement debug display update
+        const double Now = FPlatformTime::Seconds();
+        if (Now >= NextBudgetCheckTime)
+        {
+            NextBudgetCheckTime = Now + MaintenanceIntervalSeconds;
+            EnforceMemoryBudgets();
+        }
     }
 }
 
@@ -74,60 +75,19 @@ void AGWIZPoolingManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
     // Cleanup all pools when actor is destroyed
     ClearAllPools();
     
-    // Unregister as global instance if this is the global manager
-    FScopeLock Lock(&GGlobalPoolingManagerMutex);
-    if (GGlobalPoolingManager == this)
+    // Let the world spawn a fresh manager if one is requested later
+    if (UGWIZPoolingSubsystem* Subsystem = UWorld::GetSubsystem<UGWIZPoolingSubsystem>(GetWorld()))
     {
-        GGlobalPoolingManager = nullptr;
+        Subsystem->UnregisterManager(this);
     }
 }
 
 AGWIZPoolingManager* AGWIZPoolingManager::GetPoolingManager(const UObject* WorldContext)
 {
-    // Thread-safe access to global instance
-    FScopeLock Lock(&GGlobalPoolingManagerMutex);
-    
-    // Return existing global instance if available
-    if (GGlobalPoolingManager != nullptr && GGlobalPoolingManager->IsValidLowLevel())
-    {
-        return GGlobalPoolingManager;
-    }
-    
-    // Try to find existing instance in the world
-    if (WorldContext != nullptr)
-    {
-        UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::LogAndReturnNull);
-        if (World != nullptr)
-        {
-            // Find existing pooling manager in the world
-            TArray<AActor*> FoundActors;
-            UGameplayStatics::GetAllActorsOfClass(World, AGWIZPoolingManager::StaticClass(), FoundActors);
-            
-            if (FoundActors.Num() > 0)
-            {
-                AGWIZPoolingManager* FoundManager = Cast<AGWIZPoolingManager>(FoundActors[0]);
-                if (FoundManager != nullptr)
-                {
-                    GGlobalPoolingManager = FoundManager;
-                    return FoundManager;
-                }
-            }
-            
-            // Create new instance if none exists
-            FActorSpawnParameters SpawnParams;
-            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-            SpawnParams.bDeferConstruction = false;
-            
-            AGWIZPoolingManager* NewManager = World->SpawnActor<AGWIZPoolingManager>(AGWIZPoolingManager::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
-            if (NewManager != nullptr)
-            {
-                GGlobalPoolingManager = NewManager;
-                return NewManager;
-            }
-        }
-    }
-    
-    return nullptr;
+    // One manager per world, owned by the world's subsystem; no global state and no lock
+    UWorld* World = (WorldContext != nullptr && GEngine != nullptr) ? GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    UGWIZPoolingSubsystem* Subsystem = UWorld::GetSubsystem<UGWIZPoolingSubsystem>(World);
+    return Subsystem != nullptr ? Subsystem->GetManager() : nullptr;
 }
 
 UGWIZObjectPool* AGWIZPoolingManager::GetPool(TSubclassOf<UObject> ObjectClass)
@@ -139,10 +99,19 @@ UGWIZObjectPool* AGWIZPoolingManager::GetPool(TSubclassOf<UObject> ObjectClass)
         return nullptr;
     }
 
+    // Existing pools are found under the shared lock, so concurrent lookups do not serialize
+    {
+        FReadScopeLock ReadLock(RegistryLock);
+        if (UGWIZObjectPool* const* RegisteredPool = Registry.ExactPools.Find(ObjectClass.Get()))
+        {
+            return *RegisteredPool;
+        }
+    }
+    
     // Thread-safe access to pools map
     FScopeLock Lock(&PoolMutex);
     
-    // Check if pool already exists
+    // Check again, another thread may have created the pool while we waited
     UGWIZObjectPool* const* ExistingPool = Pools.Find(ObjectClass);
     if (ExistingPool != nullptr && *ExistingPool != nullptr)
     {
@@ -157,12 +126,21 @@ UGWIZObjectPool* AGWIZPoolingManager::GetPool(TSubclassOf<UObject> ObjectClass)
         return nullptr;
     }
     
-    // Initialize pool with default configuration
+    // Initialize pool with default configuration; the manager-wide switch turns on thread safety for every new pool
     NewPool->Config = DefaultConfig;
+    NewPool->Config.bEnableThreadSafety |= bEnableThreadSafety;
     NewPool->SetPooledObjectClass(ObjectClass);
+    NewPool->OnDestroyQueued.BindUObject(this, &AGWIZPoolingManager::HandleDestroyQueued);
     
-    // Store pool in map
+    // Store pool in map; subclasses that resolved to a parent pool (or to none) may now resolve here
     Pools.Add(ObjectClass, NewPool);
+    IndexPool(NewPool);
+    
+    // Never visited, so it goes in at the cursor where the least recently visited pool belongs
+    FGWIZMaintenanceEntry MaintenanceEntry;
+    MaintenanceEntry.Pool = NewPool;
+    MaintenanceOrder.Insert(MaintenanceEntry, FMath::Min(MaintenanceCursor, MaintenanceOrder.Num()));
+    RebuildRegistry();
     
     if (bEnableDebugMode)
     {
@@ -198,8 +176,11 @@ void AGWIZPoolingManager::ConfigurePool(TSubclassOf<UObject> ObjectClass, const
         return;
     }
     
-    // Apply configuration
-    Pool->Config = Config;
+    // Apply configuration (also selects the threading mode while the pool is still empty), moving the pool
+    // to its new buckets
+    UnindexPool(Pool, Pool->Config.Category, Pool->Config.Priority);
+    Pool->ConfigurePool(Config);
+    IndexPool(Pool);
     
     if (bEnableDebugMode)
     {
@@ -210,6 +191,14 @@ void AGWIZPoolingManager::ConfigurePool(TSubclassOf<UObject> ObjectClass, const
 
 UObject* AGWIZPoolingManager::GetPooledObject(TSubclassOf<UObject> ObjectClass)
 {
+    FGWIZPoolHandle Handle;
+    return GetPooledObjectWithHandle(ObjectClass, Handle);
+}
+
+UObject* AGWIZPoolingManager::GetPooledObjectWithHandle(TSubclassOf<UObject> ObjectClass, FGWIZPoolHandle& OutHandle)
+{
+    OutHandle.Reset();
+
     // Validate input
     if (!ObjectClass)
     {
@@ -226,34 +215,14 @@ UObject* AGWIZPoolingManager::GetPooledObject(TSubclassOf<UObject> ObjectClass)
     }
     
     // Get object from pool
-    UObject* Object = Pool->GetObject(ObjectClass);
+    UObject* Object = Pool->GetObjectWithHandle(ObjectClass, OutHandle);
     if (Object == nullptr)
     {
         UE_LOG(LogTemp, Error, TEXT("GWIZPoolingManager::GetPooledObject - Failed to get object from pool for class %s"), *ObjectClass->GetName());
         return nullptr;
     }
     
-    // Initialize object if it implements the poolable interface
-    if (Object->GetClass()->ImplementsInterface(UGWIZPoolable::StaticClass()))
-    {
-        IGWIZPoolable::Execute_OnPooled(Object);
-    }
-    
-    // Handle actor-specific initialization
-    if (AActor* Actor = Cast<AActor>(Object))
-    {
-        // Enable ticking if needed
-        if (Actor->PrimaryActorTick.bCanEverTick)
-        {
-            Actor->SetActorTickEnabled(true);
-        }
-        
-        // Enable rendering
-        Actor->SetActorHiddenInGame(false);
-        
-        // Enable collision
-        Actor->SetActorEnableCollision(true);
-    }
+    // The pool has already run the activation steps configured for it
     
     if (bEnableDebugMode)
     {
@@ -280,45 +249,134 @@ void AGWIZPoolingManager::ReturnPooledObject(UObject* Object)
         return;
     }
     
-    // Find the pool for this object class
-    UGWIZObjectPool* Pool = GetPoolForClass(ObjectClass);
+    // Plain objects point back at the pool that created them; only actors and foreign objects need a class lookup
+    UGWIZObjectPool* Pool = UGWIZObjectPool::GetOwningPool(Object);
+    if (Pool == nullptr || Pool->GetOuter() != this)
+    {
+        Pool = GetPoolForClass(ObjectClass);
+    }
     if (Pool == nullptr)
     {
         UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::ReturnPooledObject - No pool found for class %s"), *ObjectClass->GetName());
         return;
     }
     
-    // Clean up object if it implements the poolable interface
-    if (Object->GetClass()->ImplementsInterface(UGWIZPoolable::StaticClass()))
+    // Reject double returns
+    if (Pool->ContainsObject(Object) && !Pool->IsObjectInUse(Object))
     {
-        IGWIZPoolable::Execute_OnUnpooled(Object);
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::ReturnPooledObject - Object %s is already in its pool"), *Object->GetName());
+        return;
     }
     
-    // Handle actor-specific cleanup
-    if (AActor* Actor = Cast<AActor>(Object))
+    // Return object to pool; the pool runs the deactivation steps configured for it
+    Pool->ReturnObject(Object);
+    
+    if (bEnableDebugMode)
     {
-        // Disable ticking
-        Actor->SetActorTickEnabled(false);
-        
-        // Hide from game
-        Actor->SetActorHiddenInGame(true);
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::ReturnPooledObject - Returned object of class %s to pool"), *ObjectClass->GetName());
+    }
+}
+
+int32 AGWIZPoolingManager::GetPooledObjects(TSubclassOf<UObject> ObjectClass, int32 Count, TArray<UObject*>& OutObjects)
+{
+    // Validate input
+    if (!ObjectClass || Count <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::GetPooledObjects - Invalid object class or count provided"));
+        return 0;
+    }
+    
+    // One pool lookup for the whole batch
+    UGWIZObjectPool* Pool = GetPool(ObjectClass);
+    if (Pool == nullptr)
+    {
+        UE_LOG(LogTemp, Error, TEXT("GWIZPoolingManager::GetPooledObjects - Failed to get pool for class %s"), *ObjectClass->GetName());
+        return 0;
+    }
+    
+    // The pool runs each object's activation and updates statistics once
+    const int32 Acquired = Pool->GetObjects(ObjectClass, Count, OutObjects);
+    
+    if (bEnableDebugMode)
+    {
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::GetPooledObjects - Retrieved %d/%d objects of class %s from pool"), 
+               Acquired, Count, *ObjectClass->GetName());
+    }
+    
+    return Acquired;
+}
+
+void AGWIZPoolingManager::ReturnPooledObjects(const TArray<UObject*>& Objects)
+{
+    // Group objects by pool, resolving the pool only when the class changes
+    TMap<UGWIZObjectPool*, TArray<UObject*>> ObjectsByPool;
+    UClass* LastClass = nullptr;
+    UGWIZObjectPool* LastPool = nullptr;
+    
+    for (UObject* Object : Objects)
+    {
+        if (Object == nullptr)
+        {
+            continue;
+        }
         
-        // Disable collision
-        Actor->SetActorEnableCollision(false);
+        UClass* ObjectClass = Object->GetClass();
+        if (ObjectClass != LastClass)
+        {
+            LastClass = ObjectClass;
+            LastPool = GetPoolForClass(ObjectClass);
+            if (LastPool == nullptr)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::ReturnPooledObjects - No pool found for class %s"), *ObjectClass->GetName());
+            }
+        }
         
-        // Reset location to origin to avoid interference
-        Actor->SetActorLocation(FVector::ZeroVector);
+        if (LastPool != nullptr)
+        {
+            ObjectsByPool.FindOrAdd(LastPool).Add(Object);
+        }
     }
     
-    // Return object to pool
-    Pool->ReturnObject(Object);
+    // Each pool runs deactivation per object and updates statistics once
+    for (const auto& PoolPair : ObjectsByPool)
+    {
+        PoolPair.Key->ReturnObjects(PoolPair.Value);
+    }
     
     if (bEnableDebugMode)
     {
-        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::ReturnPooledObject - Returned object of class %s to pool"), *ObjectClass->GetName());
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::ReturnPooledObjects - Returned %d objects to %d pools"), Objects.Num(), ObjectsByPool.Num());
     }
 }
 
+bool AGWIZPoolingManager::ReturnPooledObjectByHandle(TSubclassOf<UObject> ObjectClass, const FGWIZPoolHandle& Handle)
+{
+    // Validate input
+    if (!ObjectClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::ReturnPooledObjectByHandle - Invalid object class provided"));
+        return false;
+    }
+
+    UGWIZObjectPool* Pool = GetPoolForClass(ObjectClass);
+    if (Pool == nullptr)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::ReturnPooledObjectByHandle - No pool found for class %s"), *ObjectClass->GetName());
+        return false;
+    }
+
+    // Reject stale handles before touching the object
+    UObject* Object = Pool->ResolveHandle(Handle);
+    if (Object == nullptr)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::ReturnPooledObjectByHandle - Stale handle for class %s"), *ObjectClass->GetName());
+        return false;
+    }
+
+    ReturnPooledObject(Object);
+    return true;
+}
+
 void AGWIZPoolingManager::PreWarmAllPools()
 {
     // Thread-safe access to pools map
@@ -356,13 +414,504 @@ void AGWIZPoolingManager::PreWarmAllPools()
     }
 }
 
+void AGWIZPoolingManager::QueuePreWarm(TSubclassOf<UObject> ObjectClass, int32 Count)
+{
+    // Validate input
+    if (!ObjectClass || Count <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::QueuePreWarm - Invalid object class or count provided"));
+        return;
+    }
+    
+    UGWIZObjectPool* Pool = GetPool(ObjectClass);
+    if (Pool == nullptr)
+    {
+        UE_LOG(LogTemp, Error, TEXT("GWIZPoolingManager::QueuePreWarm - Failed to get pool for class %s"), *ObjectClass->GetName());
+        return;
+    }
+    
+    FScopeLock Lock(&PoolMutex);
+    EnqueuePreWarm(Pool, Count);
+}
+
+void AGWIZPoolingManager::QueuePreWarmAllPools()
+{
+    // Thread-safe access to pools map
+    FScopeLock Lock(&PoolMutex);
+    
+    for (auto& PoolPair : Pools)
+    {
+        UGWIZObjectPool* Pool = PoolPair.Value;
+        if (Pool != nullptr)
+        {
+            EnqueuePreWarm(Pool, Pool->Config.InitialPoolSize);
+        }
+    }
+    
+    if (bEnableDebugMode)
+    {
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::QueuePreWarmAllPools - Queued %d pools, %d objects to create"), 
+               PreWarmQueue.Num(), PreWarmObjectsRequested - PreWarmObjectsCreated);
+    }
+}
+
+void AGWIZPoolingManager::CancelPreWarm()
+{
+    FScopeLock Lock(&PoolMutex);
+    
+    PreWarmQueue.Empty();
+    PreWarmObjectsRequested = 0;
+    PreWarmObjectsCreated = 0;
+}
+
+bool AGWIZPoolingManager::IsPreWarming() const
+{
+    return PreWarmQueue.Num() > 0;
+}
+
+float AGWIZPoolingManager::GetPreWarmProgress() const
+{
+    return PreWarmObjectsRequested > 0 ? static_cast<float>(PreWarmObjectsCreated) / static_cast<float>(PreWarmObjectsRequested) : 1.0f;
+}
+
+void AGWIZPoolingManager::EnqueuePreWarm(UGWIZObjectPool* Pool, int32 Count)
+{
+    const int32 Deficit = Pool->GetPreWarmDeficit(Count);
+    
+    // Extend an existing request for the same pool instead of queueing it twice
+    for (FGWIZPreWarmRequest& Request : PreWarmQueue)
+    {
+        if (Request.Pool.Get() == Pool)
+        {
+            if (Count > Request.TargetCount)
+            {
+                PreWarmObjectsRequested += Deficit - Pool->GetPreWarmDeficit(Request.TargetCount);
+                Request.TargetCount = Count;
+            }
+            return;
+        }
+    }
+    
+    if (Deficit == 0)
+    {
+        return;
+    }
+    
+    FGWIZPreWarmRequest NewRequest;
+    NewRequest.Pool = Pool;
+    NewRequest.TargetCount = Count;
+    NewRequest.Priority = Pool->Config.Priority;
+    
+    // Keep the queue ordered by descending priority; equal priorities stay first-come first-served
+    const int32 InsertIndex = Algo::UpperBound(PreWarmQueue, NewRequest, [](const FGWIZPreWarmRequest& A, const FGWIZPreWarmRequest& B)
+    {
+        return A.Priority > B.Priority;
+    });
+    PreWarmQueue.Insert(NewRequest, InsertIndex);
+    PreWarmObjectsRequested += Deficit;
+}
+
+void AGWIZPoolingManager::UpdateAdaptiveSizing()
+{
+    // Thread-safe access to pools map
+    FScopeLock Lock(&PoolMutex);
+    
+    const double Now = FPlatformTime::Seconds();
+    
+    // Growing unprotected pools past the budget would only have them evicted again
+    const bool bOverBudget = MemoryBudgetBytes > 0 && GetTotalMemoryUsage() >= MemoryBudgetBytes;
+    
+    for (auto& PoolPair : Pools)
+    {
+        if (PoolPair.Value != nullptr)
+        {
+            ApplyAdaptiveSizing(PoolPair.Value, Now, bOverBudget);
+        }
+    }
+}
+
+void AGWIZPoolingManager::ApplyAdaptiveSizing(UGWIZObjectPool* Pool, double Now, bool bOverBudget)
+{
+    // Over the memory budget only protected pools may grow; the pool is told up front so it does not record a grow
+    // that never happens
+    const bool bAllowGrow = !bOverBudget || Pool->Config.Priority >= EvictionProtectedPriority;
+    
+    FGWIZResizeDecision Decision;
+    if (!Pool->EvaluateAdaptiveSize(Now, Decision, bAllowGrow))
+    {
+        return;
+    }
+    
+    const FString ClassName = Pool->GetPooledObjectClass()->GetName();
+    
+    if (Decision.IsGrow())
+    {
+        // Time-sliced so a sudden wave does not create every object in one frame
+        EnqueuePreWarm(Pool, Decision.TargetTotal - Decision.InUse);
+        
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::UpdateAdaptiveSizing - Growing %s from %d to %d objects (window peak %d in use, %d misses)"),
+               *ClassName, Decision.CurrentTotal, Decision.TargetTotal, Decision.WindowPeak, Decision.WindowMisses);
+    }
+    else
+    {
+        const int32 Removed = Pool->TrimIdleObjects(Decision.TargetTotal - Decision.InUse);
+        
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::UpdateAdaptiveSizing - Shrinking %s from %d to %d objects (window peak %d in use, over-provisioned for %.1fs, removed %d)"),
+               *ClassName, Decision.CurrentTotal, Decision.TargetTotal, Decision.WindowPeak, Decision.OverProvisionedSeconds, Removed);
+    }
+}
+
+int32 AGWIZPoolingManager::RunMaintenance()
+{
+    // Thread-safe access to pools map
+    FScopeLock Lock(&PoolMutex);
+    
+    const double Deadline = FPlatformTime::Seconds() + MaintenanceFrameBudgetUs / 1.0e6;
+    int32 Visited = 0;
+    
+    while (Visited < MaintenanceOrder.Num())
+    {
+        if (MaintenanceCursor >= MaintenanceOrder.Num())
+        {
+            MaintenanceCursor = 0;
+        }
+        
+        // The entry under the cursor was visited longest ago, so once it is not due no other entry is either
+        FGWIZMaintenanceEntry& Entry = MaintenanceOrder[MaintenanceCursor];
+        const double Now = FPlatformTime::Seconds();
+        if (Now - Entry.LastVisitTime < MaintenanceIntervalSeconds || (Visited > 0 && Now >= Deadline))
+        {
+            break;
+        }
+        
+        MaintainPool(Entry, Now);
+        ++MaintenanceCursor;
+        ++Visited;
+    }
+    
+    return Visited;
+}
+
+void AGWIZPoolingManager::MaintainPool(FGWIZMaintenanceEntry& Entry, double Now)
+{
+    UGWIZObjectPool* Pool = Entry.Pool;
+    Entry.LastVisitTime = Now;
+    
+    // Statistics: memory measurements are cached per class; refresh the stalest one
+    if (bEnablePerformanceMonitoring)
+    {
+        Pool->RefreshMemoryMeasurement(Now);
+    }
+    
+    if (bEnableAdaptiveSizing)
+    {
+        ApplyAdaptiveSizing(Pool, Now, bOverMemoryBudget);
+    }
+    
+    // Trimming: a pool nobody has used for AutoCleanupIdleSeconds gives back everything above its eviction floor.
+    // Short-lived objects are often all back by the time of a visit, so any acquire since the last visit counts as use
+    const int32 Acquires = Pool->GetAcquireCount();
+    const bool bUsedSinceLastVisit = Acquires != Entry.AcquiresAtLastVisit;
+    Entry.AcquiresAtLastVisit = Acquires;
+    
+    if (bUsedSinceLastVisit || Pool->GetObjectsInUse() > 0)
+    {
+        Entry.IdleSince = -1.0;
+    }
+    else if (Entry.IdleSince < 0.0)
+    {
+        Entry.IdleSince = Now;
+    }
+    
+    if (bEnableAutoCleanup && Entry.IdleSince >= 0.0 && Now - Entry.IdleSince >= AutoCleanupIdleSeconds
+        && Pool->GetCurrentPoolSize() > GetEvictionFloor(Pool))
+    {
+        const int32 Removed = Pool->TrimIdleObjects(GetEvictionFloor(Pool));
+        
+        if (bEnableDebugMode)
+        {
+            UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::MaintainPool - Auto cleanup removed %d idle objects from %s (unused for %.1fs)"),
+                   Removed, *Pool->GetPooledObjectClass()->GetName(), Now - Entry.IdleSince);
+        }
+    }
+    
+    // Validation is only meaningful while no other thread can be using the pool
+    if (!Pool->IsThreadSafe() && !Pool->ValidatePool())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::MaintainPool - Pool %s failed validation"), *Pool->GetPooledObjectClass()->GetName());
+    }
+    
+    // Debug display: one line per pool, refreshed on every visit
+    if (bEnableDebugMode && GEngine != nullptr)
+    {
+        const FGWIZPoolStatistics Stats = Pool->GetStatistics();
+        GEngine->AddOnScreenDebugMessage(static_cast<uint64>(Pool->GetUniqueID()), MaintenanceIntervalSeconds * 2.0f, FColor::Cyan,
+            FString::Printf(TEXT("%s [%s]: %d in use, %d idle, %.0f%% hits, %.1f KB"),
+                            *Pool->GetPooledObjectClass()->GetName(), *Pool->Config.Category.ToString(), Stats.ObjectsInUse,
+                            Stats.CurrentPoolSize, Stats.HitRate * 100.0f, Pool->GetMemoryUsage() / 1024.0f));
+    }
+}
+
+int64 AGWIZPoolingManager::EnforceMemoryBudgets()
+{
+    // Thread-safe access to pools map
+    FScopeLock Lock(&PoolMutex);
+    
+    // Lowest priority first, so high-priority pools are only touched once everything below them is at its floor
+    auto ByPriority = [](const UGWIZObjectPool& A, const UGWIZObjectPool& B)
+    {
+        return A.Config.Priority < B.Config.Priority;
+    };
+    
+    int64 TotalFreed = 0;
+    
+    // Category budgets only look at their own bucket
+    for (const TPair<FName, int64>& Budget : CategoryMemoryBudgets)
+    {
+        TConstArrayView<UGWIZObjectPool*> CategoryPools = GetPoolsInCategory(Budget.Key);
+        if (Budget.Value <= 0 || CategoryPools.Num() == 0)
+        {
+            continue;
+        }
+        
+        int64 CategoryUsage = 0;
+        for (const UGWIZObjectPool* Pool : CategoryPools)
+        {
+            CategoryUsage += Pool->GetMemoryUsage();
+        }
+        if (CategoryUsage <= Budget.Value)
+        {
+            continue;
+        }
+        
+        TArray<UGWIZObjectPool*> EvictionOrder(CategoryPools);
+        EvictionOrder.StableSort(ByPriority);
+        
+        const int64 Freed = EvictIdleMemory(EvictionOrder, CategoryUsage - Budget.Value, Budget.Key);
+        CategoryUsage -= Freed;
+        TotalFreed += Freed;
+        
+        if (CategoryUsage > Budget.Value)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::EnforceMemoryBudgets - Category %s still over budget: %lld of %lld bytes (remaining memory is in use or protected)"),
+                   *Budget.Key.ToString(), CategoryUsage, Budget.Value);
+        }
+    }
+    
+    if (MemoryBudgetBytes <= 0)
+    {
+        bOverMemoryBudget = false;
+        return TotalFreed;
+    }
+    
+    int64 TotalMemory = 0;
+    for (auto& PoolPair : Pools)
+    {
+        if (PoolPair.Value != nullptr)
+        {
+            TotalMemory += PoolPair.Value->GetMemoryUsage();
+        }
+    }
+    
+    // Struct pools count against the global budget but hold nothing that can be evicted
+    for (auto& StructPoolPair : StructPools)
+    {
+        TotalMemory += StructPoolPair.Value->GetStatistics().MemoryUsage;
+    }
+    
+    if (TotalMemory > MemoryBudgetBytes)
+    {
+        // The priority buckets are already the eviction order once their keys are sorted
+        TArray<int32> Priorities;
+        PoolsByPriority.GetKeys(Priorities);
+        Priorities.Sort();
+        
+        TArray<UGWIZObjectPool*> EvictionOrder;
+        EvictionOrder.Reserve(Pools.Num());
+        for (int32 Priority : Priorities)
+        {
+            TConstArrayView<UGWIZObjectPool*> Bucket = GetPoolsAtPriority(Priority);
+            EvictionOrder.Append(Bucket.GetData(), Bucket.Num());
+        }
+        
+        const int64 Freed = EvictIdleMemory(EvictionOrder, TotalMemory - MemoryBudgetBytes, NAME_None);
+        TotalMemory -= Freed;
+        TotalFreed += Freed;
+        
+        if (TotalMemory > MemoryBudgetBytes)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingManager::EnforceMemoryBudgets - Still over budget: %lld of %lld bytes (remaining memory is in use or protected)"),
+                   TotalMemory, MemoryBudgetBytes);
+        }
+    }
+    
+    bOverMemoryBudget = TotalMemory >= MemoryBudgetBytes;
+    return TotalFreed;
+}
+
+int64 AGWIZPoolingManager::EvictIdleMemory(TConstArrayView<UGWIZObjectPool*> EvictionOrder, int64 BytesToFree, FName BudgetName)
+{
+    int64 Freed = 0;
+    
+    for (UGWIZObjectPool* Pool : EvictionOrder)
+    {
+        if (Freed >= BytesToFree)
+        {
+            break;
+        }
+        
+        const int64 PoolFreed = Pool->EvictIdleMemory(BytesToFree - Freed, GetEvictionFloor(Pool));
+        if (PoolFreed > 0)
+        {
+            Freed += PoolFreed;
+            
+            UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::EnforceMemoryBudgets - Evicted %lld bytes from %s (priority %d, %d idle left) for the %s budget"),
+                   PoolFreed, *Pool->GetPooledObjectClass()->GetName(), Pool->Config.Priority, Pool->GetCurrentPoolSize(),
+                   BudgetName.IsNone() ? TEXT("global") : *BudgetName.ToString());
+        }
+    }
+    
+    return Freed;
+}
+
+int32 AGWIZPoolingManager::GetEvictionFloor(const UGWIZObjectPool* Pool) const
+{
+    if (Pool->Config.Priority >= EvictionProtectedPriority)
+    {
+        return FMath::Max(Pool->Config.MinPoolSize, Pool->Config.InitialPoolSize);
+    }
+    return Pool->Config.MinPoolSize;
+}
+
+void AGWIZPoolingManager::RebuildRegistry()
+{
+    FWriteScopeLock WriteLock(RegistryLock);
+    
+    Registry.ExactPools.Reset();
+    Registry.AllPools.Reset();
+    
+    for (auto& PoolPair : Pools)
+    {
+        UGWIZObjectPool* Pool = PoolPair.Value;
+        if (Pool != nullptr)
+        {
+            Registry.ExactPools.Add(PoolPair.Key.Get(), Pool);
+            Registry.AllPools.Add(Pool);
+        }
+    }
+    
+    // Resolutions through a superclass (or to no pool) may have changed, so only exact matches carry over
+    Registry.ResolvedPools = Registry.ExactPools;
+}
+
+void AGWIZPoolingManager::ProcessPendingDestroys()
+{
+    FScopeLock Lock(&PoolMutex);
+    
+    const double Deadline = FPlatformTime::Seconds() + DestroyFrameBudgetMs / 1000.0;
+    
+    // Only pools with work are visited, and each frame picks up after the last pool served, so a long queue
+    // early in the list cannot starve the pools behind it
+    while (PoolsWithPendingDestroys.Num() > 0)
+    {
+        if (DestroyCursor >= PoolsWithPendingDestroys.Num())
+        {
+            DestroyCursor = 0;
+        }
+        
+        UGWIZObjectPool* Pool = PoolsWithPendingDestroys[DestroyCursor];
+        Pool->ProcessPendingDestroy(Deadline);
+        
+        // A drained pool leaves the list; the next pool moves up under the cursor
+        if (Pool->GetPendingDestroyCount() == 0)
+        {
+            PoolsWithPendingDestroys.RemoveAt(DestroyCursor, 1, EAllowShrinking::No);
+        }
+        else
+        {
+            ++DestroyCursor;
+        }
+        
+        if (FPlatformTime::Seconds() >= Deadline)
+        {
+            break;
+        }
+    }
+}
+
+void AGWIZPoolingManager::HandleDestroyQueued(UGWIZObjectPool* Pool)
+{
+    FScopeLock Lock(&PoolMutex);
+    PoolsWithPendingDestroys.AddUnique(Pool);
+}
+
+void AGWIZPoolingManager::ProcessPreWarmQueue()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const double Deadline = StartTime + PreWarmFrameBudgetMs / 1000.0;
+    int32 CreatedThisFrame = 0;
+    
+    {
+        FScopeLock Lock(&PoolMutex);
+        
+        while (PreWarmQueue.Num() > 0)
+        {
+            FGWIZPreWarmRequest& Request = PreWarmQueue[0];
+            UGWIZObjectPool* Pool = Request.Pool.Get();
+            
+            int32 Created = 0;
+            if (Pool != nullptr)
+            {
+                Created = Pool->PreWarmPoolUntil(Request.TargetCount, Deadline);
+                CreatedThisFrame += Created;
+            }
+            
+            // Drop finished requests, and requests whose pool is gone or can no longer create objects
+            if (Pool == nullptr || Created == 0 || Pool->GetPreWarmDeficit(Request.TargetCount) == 0)
+            {
+                if (bEnableDebugMode && Pool != nullptr)
+                {
+                    UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::ProcessPreWarmQueue - Finished pool for class %s (%d available)"), 
+                           *GetNameSafe(Pool->GetPooledObjectClass()), Pool->GetPoolSize());
+                }
+                PreWarmQueue.RemoveAt(0);
+            }
+            
+            if (FPlatformTime::Seconds() >= Deadline)
+            {
+                break;
+            }
+        }
+        
+        PreWarmObjectsCreated = FMath::Min(PreWarmObjectsCreated + CreatedThisFrame, PreWarmObjectsRequested);
+    }
+    
+    if (CreatedThisFrame > 0)
+    {
+        OnPreWarmProgress.Broadcast(PreWarmObjectsCreated, PreWarmObjectsRequested);
+    }
+    
+    if (bEnableDebugMode)
+    {
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::ProcessPreWarmQueue - Created %d objects in %.2f ms (%d/%d)"), 
+               CreatedThisFrame, (FPlatformTime::Seconds() - StartTime) * 1000.0, PreWarmObjectsCreated, PreWarmObjectsRequested);
+    }
+    
+    if (PreWarmQueue.Num() == 0)
+    {
+        PreWarmObjectsRequested = 0;
+        PreWarmObjectsCreated = 0;
+        OnPreWarmComplete.Broadcast();
+    }
+}
+
 void AGWIZPoolingManager::PrintAllPoolStatistics()
 {
     // Thread-safe access to pools map
     FScopeLock Lock(&PoolMutex);
     
     int32 TotalPools = Pools.Num();
-    if (TotalPools == 0)
+    if (TotalPools == 0 && StructPools.Num() == 0)
     {
         UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::PrintAllPoolStatistics - No pools to display"));
         return;
@@ -371,6 +920,7 @@ void AGWIZPoolingManager::PrintAllPoolStatistics()
     // Print header
     UE_LOG(LogTemp, Log, TEXT("=== GWIZ Pooling System Statistics ==="));
     UE_LOG(LogTemp, Log, TEXT("Total Pools: %d"), TotalPools);
+    UE_LOG(LogTemp, Log, TEXT("Total Struct Pools: %d"), StructPools.Num());
     UE_LOG(LogTemp, Log, TEXT(""));
     
     // Calculate global totals
@@ -408,11 +958,34 @@ void AGWIZPoolingManager::PrintAllPoolStatistics()
             UE_LOG(LogTemp, Log, TEXT("  Memory Usage: %lld bytes (%.2f MB)"), 
                    Stats.MemoryUsage, Stats.MemoryUsage / (1024.0f * 1024.0f));
             UE_LOG(LogTemp, Log, TEXT("  Average Lifetime: %.2f seconds"), Stats.AverageLifetime);
+            UE_LOG(LogTemp, Log, TEXT("  Lifetime p50/p95/p99: %.3f / %.3f / %.3f seconds"), Stats.LifetimeP50, Stats.LifetimeP95, Stats.LifetimeP99);
+            UE_LOG(LogTemp, Log, TEXT("  Oldest Outstanding: %.2f seconds"), Stats.OldestOutstandingAge);
             UE_LOG(LogTemp, Log, TEXT("  Peak Concurrent Usage: %d"), Stats.PeakConcurrentUsage);
             UE_LOG(LogTemp, Log, TEXT(""));
         }
     }
     
+    // Print struct pool statistics
+    for (auto& StructPoolPair : StructPools)
+    {
+        const FGWIZPoolStatistics Stats = StructPoolPair.Value->GetStatistics();
+        
+        TotalObjects += Stats.GetTotalObjects();
+        TotalObjectsInUse += Stats.ObjectsInUse;
+        TotalMemoryUsage += Stats.MemoryUsage;
+        TotalPoolHits += Stats.PoolHits;
+        TotalPoolMisses += Stats.PoolMisses;
+        
+        UE_LOG(LogTemp, Log, TEXT("Struct Pool: %s"), *StructPoolPair.Key.ToString());
+        UE_LOG(LogTemp, Log, TEXT("  Capacity: %d"), Stats.TotalObjectsCreated);
+        UE_LOG(LogTemp, Log, TEXT("  Elements In Use: %d"), Stats.ObjectsInUse);
+        UE_LOG(LogTemp, Log, TEXT("  Hit Rate: %.2f%%"), Stats.HitRate * 100.0f);
+        UE_LOG(LogTemp, Log, TEXT("  Memory Usage: %lld bytes (%.2f MB)"), 
+               Stats.MemoryUsage, Stats.MemoryUsage / (1024.0f * 1024.0f));
+        UE_LOG(LogTemp, Log, TEXT("  Peak Concurrent Usage: %d"), Stats.PeakConcurrentUsage);
+        UE_LOG(LogTemp, Log, TEXT(""));
+    }
+    
     // Print global summary
     UE_LOG(LogTemp, Log, TEXT("=== Global Summary ==="));
     UE_LOG(LogTemp, Log, TEXT("Total Objects: %d"), TotalObjects);
@@ -470,14 +1043,11 @@ TArray<UGWIZObjectPool*> AGWIZPoolingManager::GetAllPools() const
 {
     TArray<UGWIZObjectPool*> Result;
     
-    // Thread-safe access to pools map
-    FScopeLock Lock(&PoolMutex);
-    
-    // Copy all pools to result array
-    Pools.GenerateValueArray(Result);
-    
-    // Filter out null pointers
-    Result.RemoveAll([](UGWIZObjectPool* Pool) { return Pool == nullptr; });
+    // The registry holds only valid pools
+    {
+        FReadScopeLock ReadLock(RegistryLock);
+        Result = Registry.AllPools;
+    }
     
     if (bEnableDebugMode)
     {
@@ -489,7 +1059,14 @@ TArray<UGWIZObjectPool*> AGWIZPoolingManager::GetAllPools() const
 
 int32 AGWIZPoolingManager::GetPoolCount() const
 {
-    return Pools.Num();
+    FReadScopeLock ReadLock(RegistryLock);
+    return Registry.AllPools.Num();
+}
+
+int32 AGWIZPoolingManager::GetStructPoolCount() const
+{
+    FScopeLock Lock(&PoolMutex);
+    return StructPools.Num();
 }
 
 void AGWIZPoolingManager::ClearAllPools()
@@ -521,8 +1098,19 @@ void AGWIZPoolingManager::ClearAllPools()
         }
     }
     
-    // Clear the pools map
+    // Clear the pools map and any pre-warm work queued for them
     Pools.Empty();
+    PoolsByCategory.Empty();
+    PoolsByPriority.Empty();
+    MaintenanceOrder.Empty();
+    MaintenanceCursor = 0;
+    PoolsWithPendingDestroys.Empty();
+    DestroyCursor = 0;
+    RebuildRegistry();
+    StructPools.Empty();
+    PreWarmQueue.Empty();
+    PreWarmObjectsRequested = 0;
+    PreWarmObjectsCreated = 0;
     
     // Clear historical statistics
     HistoricalStats.Empty();
@@ -542,19 +1130,37 @@ UGWIZObjectPool* AGWIZPoolingManager::GetPoolForClass(TSubclassOf<UObject> Objec
         return nullptr;
     }
     
+    // Every class pays for the resolution below once; later lookups are a single hash probe under the shared lock
+    {
+        FReadScopeLock ReadLock(RegistryLock);
+        if (UGWIZObjectPool* const* CachedPool = Registry.ResolvedPools.Find(ObjectClass.Get()))
+        {
+            return *CachedPool;
+        }
+    }
+    
     // Thread-safe access to pools map
     FScopeLock Lock(&PoolMutex);
     
+    // Check again, another thread may have resolved the class while we waited. Writers hold PoolMutex, so the
+    // registry cannot change under us here
+    if (UGWIZObjectPool* const* CachedPool = Registry.ResolvedPools.Find(ObjectClass.Get()))
+    {
+        return *CachedPool;
+    }
+    
+    UGWIZObjectPool* ResolvedPool = nullptr;
+    
     // Try to find exact class match first
     UGWIZObjectPool* const* FoundPool = Pools.Find(ObjectClass);
     if (FoundPool != nullptr && *FoundPool != nullptr)
     {
-        return *FoundPool;
+        ResolvedPool = *FoundPool;
     }
     
     // If no exact match, try to find a pool for a parent class
     UClass* CurrentClass = ObjectClass;
-    while (CurrentClass != nullptr)
+    while (ResolvedPool == nullptr && CurrentClass != nullptr)
     {
         UClass* ParentClass = CurrentClass->GetSuperClass();
         if (ParentClass != nullptr && ParentClass != UObject::StaticClass())
@@ -567,40 +1173,35 @@ UGWIZObjectPool* AGWIZPoolingManager::GetPoolForClass(TSubclassOf<UObject> Objec
                     UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::GetPoolForClass - Found pool for parent class %s for requested class %s"), 
                            *ParentClass->GetName(), *ObjectClass->GetName());
                 }
-                return *ParentPool;
+                ResolvedPool = *ParentPool;
             }
         }
         CurrentClass = ParentClass;
     }
     
-    if (bEnableDebugMode)
+    if (ResolvedPool == nullptr && bEnableDebugMode)
     {
         UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::GetPoolForClass - No pool found for class %s"), *ObjectClass->GetName());
     }
     
-    return nullptr;
+    // Misses are cached too, so returning unpooled objects does not repeat the walk; one entry per class
+    {
+        FWriteScopeLock WriteLock(RegistryLock);
+        Registry.ResolvedPools.Add(ObjectClass.Get(), ResolvedPool);
+    }
+    return ResolvedPool;
 }
 
-TArray<UGWIZObjectPool*> AGWIZPoolingManager::GetPoolsByCategory(const FString& Category) const
+TArray<UGWIZObjectPool*> AGWIZPoolingManager::GetPoolsByCategory(FName Category) const
 {
-    TArray<UGWIZObjectPool*> Result;
-    
-    // Thread-safe access to pools map
+    // Thread-safe access to the index
     FScopeLock Lock(&PoolMutex);
     
-    // Find pools matching the requested category
-    for (auto& PoolPair : Pools)
-    {
-        UGWIZObjectPool* Pool = PoolPair.Value;
-        if (Pool != nullptr && Pool->Config.Category.Equals(Category, ESearchCase::IgnoreCase))
-        {
-            Result.Add(Pool);
-        }
-    }
+    TArray<UGWIZObjectPool*> Result(GetPoolsInCategory(Category));
     
     if (bEnableDebugMode)
     {
-        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::GetPoolsByCategory - Found %d pools for category: %s"), Result.Num(), *Category);
+        UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::GetPoolsByCategory - Found %d pools for category: %s"), Result.Num(), *Category.ToString());
     }
     
     return Result;
@@ -608,20 +1209,10 @@ TArray<UGWIZObjectPool*> AGWIZPoolingManager::GetPoolsByCategory(const FString&
 
 TArray<UGWIZObjectPool*> AGWIZPoolingManager::GetPoolsByPriority(int32 Priority) const
 {
-    TArray<UGWIZObjectPool*> Result;
-    
-    // Thread-safe access to pools map
+    // Thread-safe access to the index
     FScopeLock Lock(&PoolMutex);
     
-    // Find pools matching the requested priority
-    for (auto& PoolPair : Pools)
-    {
-        UGWIZObjectPool* Pool = PoolPair.Value;
-        if (Pool != nullptr && Pool->Config.Priority == Priority)
-        {
-            Result.Add(Pool);
-        }
-    }
+    TArray<UGWIZObjectPool*> Result(GetPoolsAtPriority(Priority));
     
     if (bEnableDebugMode)
     {
@@ -631,6 +1222,46 @@ TArray<UGWIZObjectPool*> AGWIZPoolingManager::GetPoolsByPriority(int32 Priority)
     return Result;
 }
 
+TConstArrayView<UGWIZObjectPool*> AGWIZPoolingManager::GetPoolsInCategory(FName Category) const
+{
+    const TArray<UGWIZObjectPool*>* Bucket = PoolsByCategory.Find(Category);
+    return Bucket != nullptr ? TConstArrayView<UGWIZObjectPool*>(*Bucket) : TConstArrayView<UGWIZObjectPool*>();
+}
+
+TConstArrayView<UGWIZObjectPool*> AGWIZPoolingManager::GetPoolsAtPriority(int32 Priority) const
+{
+    const TArray<UGWIZObjectPool*>* Bucket = PoolsByPriority.Find(Priority);
+    return Bucket != nullptr ? TConstArrayView<UGWIZObjectPool*>(*Bucket) : TConstArrayView<UGWIZObjectPool*>();
+}
+
+void AGWIZPoolingManager::IndexPool(UGWIZObjectPool* Pool)
+{
+    PoolsByCategory.FindOrAdd(Pool->Config.Category).Add(Pool);
+    PoolsByPriority.FindOrAdd(Pool->Config.Priority).Add(Pool);
+}
+
+void AGWIZPoolingManager::UnindexPool(UGWIZObjectPool* Pool, FName Category, int32 Priority)
+{
+    // Buckets are small, so a linear removal is cheaper than keeping per-pool positions; empty buckets are dropped
+    if (TArray<UGWIZObjectPool*>* CategoryBucket = PoolsByCategory.Find(Category))
+    {
+        CategoryBucket->RemoveSingleSwap(Pool, EAllowShrinking::No);
+        if (CategoryBucket->Num() == 0)
+        {
+            PoolsByCategory.Remove(Category);
+        }
+    }
+    
+    if (TArray<UGWIZObjectPool*>* PriorityBucket = PoolsByPriority.Find(Priority))
+    {
+        PriorityBucket->RemoveSingleSwap(Pool, EAllowShrinking::No);
+        if (PriorityBucket->Num() == 0)
+        {
+            PoolsByPriority.Remove(Priority);
+        }
+    }
+}
+
 void AGWIZPoolingManager::CleanupUnusedPools()
 {
     // Thread-safe access to pools map
@@ -671,27 +1302,28 @@ void AGWIZPoolingManager::CleanupUnusedPools()
             UGWIZObjectPool* Pool = *PoolPtr;
             FGWIZPoolStatistics Stats = Pool->GetStatistics();
             
-            // Reduce pool size to minimum
-            int32 ObjectsToRemove = Stats.CurrentPoolSize - Pool->Config.MinPoolSize;
-            if (ObjectsToRemove > 0)
+            // Reduce pool size to minimum; removed objects are destroyed within the per-frame budget
+            if (Stats.CurrentPoolSize > Pool->Config.MinPoolSize)
             {
-                // Remove excess objects from pool
-                for (int32 i = 0; i < ObjectsToRemove; ++i)
-                {
-                    Pool->RemoveFromPool(nullptr); // Remove from available pool
-                }
+                const int32 ObjectsRemoved = Pool->TrimIdleObjects(Pool->Config.MinPoolSize);
                 
                 CleanedPools++;
                 
                 if (bEnableDebugMode)
                 {
                     UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::CleanupUnusedPools - Cleaned up %d objects from pool %s"), 
-                           ObjectsToRemove, *ClassToCleanup->GetName());
+                           ObjectsRemoved, *ClassToCleanup->GetName());
                 }
             }
         }
     }
     
+    // Struct pools give back trailing chunks that hold no live elements
+    for (auto& StructPoolPair : StructPools)
+    {
+        StructPoolPair.Value->TrimUnusedChunks();
+    }
+    
     if (bEnableDebugMode)
     {
         UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::CleanupUnusedPools - Completed cleanup of %d pools"), CleanedPools);
@@ -702,19 +1334,24 @@ int64 AGWIZPoolingManager::GetTotalMemoryUsage() const
 {
     int64 TotalMemoryUsage = 0;
     
-    // Thread-safe access to pools map
-    FScopeLock Lock(&PoolMutex);
-    
     // Calculate memory usage from all pools
-    for (auto& PoolPair : Pools)
     {
-        UGWIZObjectPool* Pool = PoolPair.Value;
-        if (Pool != nullptr)
+        FReadScopeLock ReadLock(RegistryLock);
+        for (UGWIZObjectPool* Pool : Registry.AllPools)
         {
             TotalMemoryUsage += Pool->GetMemoryUsage();
         }
     }
     
+    // Struct pools are not in the registry and still need the lock
+    {
+        FScopeLock Lock(&PoolMutex);
+        for (auto& StructPoolPair : StructPools)
+        {
+            TotalMemoryUsage += StructPoolPair.Value->GetStatistics().MemoryUsage;
+        }
+    }
+    
     if (bEnableDebugMode)
     {
         UE_LOG(LogTemp, Log, TEXT("GWIZPoolingManager::GetTotalMemoryUsage - Total memory usage: %lld bytes (%.2f MB)"), 
@@ -728,14 +1365,10 @@ int32 AGWIZPoolingManager::GetTotalObjects() const
 {
     int32 TotalObjects = 0;
     
-    // Thread-safe access to pools map
-    FScopeLock Lock(&PoolMutex);
-    
     // Calculate total objects from all pools
-    for (auto& PoolPair : Pools)
     {
-        UGWIZObjectPool* Pool = PoolPair.Value;
-        if (Pool != nullptr)
+        FReadScopeLock ReadLock(RegistryLock);
+        for (UGWIZObjectPool* Pool : Registry.AllPools)
         {
             FGWIZPoolStatistics Stats = Pool->GetStatistics();
             TotalObjects += Stats.GetTotalObjects();
@@ -754,14 +1387,10 @@ int32 AGWIZPoolingManager::GetTotalObjectsInUse() const
 {
     int32 TotalObjectsInUse = 0;
     
-    // Thread-safe access to pools map
-    FScopeLock Lock(&PoolMutex);
-    
     // Calculate total objects in use from all pools
-    for (auto& PoolPair : Pools)
     {
-        UGWIZObjectPool* Pool = PoolPair.Value;
-        if (Pool != nullptr)
+        FReadScopeLock ReadLock(RegistryLock);
+        for (UGWIZObjectPool* Pool : Registry.AllPools)
         {
             FGWIZPoolStatistics Stats = Pool->GetStatistics();
             TotalObjectsInUse += Stats.ObjectsInUse;
@@ -775,10 +1404,3 @@ int32 AGWIZPoolingManager::GetTotalObjectsInUse() const
     
     return TotalObjectsInUse;
 }
-
-// TODO: Implement UpdatePerformanceMetrics() method
-
-// TODO: Implement PerformAutoCleanup() method
-
-// TODO: Implement UpdateDebugDisplay() method
-
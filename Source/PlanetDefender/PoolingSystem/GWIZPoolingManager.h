@@ -5,10 +5,56 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
 #include "GWIZObjectPool.h"
+#include "GWIZStructPool.h"
+#include "GWIZTypedPool.h"
 #include "PoolingTypes.h"
+#include "HAL/CriticalSection.h"
 #include "GWIZPoolingManager.generated.h"
 
+// Broadcast after each frame of queued pre-warming that created objects
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGWIZOnPreWarmProgress, int32, ObjectsCreated, int32, ObjectsRequested);
+
+// Broadcast once the pre-warm queue has been drained
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGWIZOnPreWarmComplete);
+
+// Pending pre-warm work for one pool, processed by AGWIZPoolingManager::Tick
+struct FGWIZPreWarmRequest
+{
+	TWeakObjectPtr<UGWIZObjectPool> Pool;
+	int32 TargetCount = 0;
+	int32 Priority = 0;
+};
+
+// Round-robin maintenance bookkeeping for one pool, owned by AGWIZPoolingManager
+struct FGWIZMaintenanceEntry
+{
+	UGWIZObjectPool* Pool = nullptr;
+	double LastVisitTime = 0.0;
+
+	// When maintenance first saw the pool unused since the previous visit, or a negative value while it is in use
+	double IdleSince = -1.0;
+
+	// UGWIZObjectPool::GetAcquireCount at the previous visit
+	int32 AcquiresAtLastVisit = 0;
+};
+
+// AGWIZPoolingManager's lookup tables, read under a shared lock and only written when pools are created or
+// cleared, or a class is resolved for the first time
+struct FGWIZPoolRegistry
+{
+	// Pools by their exact class
+	TMap<TObjectKey<UClass>, UGWIZObjectPool*> ExactPools;
+
+	// Class to resolved pool (exact or nearest pooled superclass; nullptr if none). Seeded with ExactPools,
+	// other classes are added on first lookup
+	TMap<TObjectKey<UClass>, UGWIZObjectPool*> ResolvedPools;
+
+	// Every pool, in Pools order
+	TArray<UGWIZObjectPool*> AllPools;
+};
+
 UCLASS()
 class PLANETDEFENDER_API AGWIZPoolingManager : public AActor
 {
@@ -18,14 +64,21 @@ public:
 	// Sets default values for this actor's properties
 	AGWIZPoolingManager();
 
-	// Global pool manager instance
-	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pooling")
+	// Pooling manager of the context object's world (see UGWIZPoolingSubsystem); spawned on first use
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pooling", meta = (WorldContext = "WorldContext"))
 	static AGWIZPoolingManager* GetPoolingManager(const UObject* WorldContext);
 
 	// Get or create pool for object class
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	UGWIZObjectPool* GetPool(TSubclassOf<UObject> ObjectClass);
 
+	// Get or create pool for T as a typed view that returns T* and binds native lifecycle hooks at compile time
+	template <typename T>
+	TGWIZTypedPool<T> GetTypedPool()
+	{
+		return TGWIZTypedPool<T>(GetPool(T::StaticClass()));
+	}
+
 	// Configure pool for object class
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	void ConfigurePool(TSubclassOf<UObject> ObjectClass, const FGWIZPoolConfig& Config);
@@ -34,14 +87,66 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	UObject* GetPooledObject(TSubclassOf<UObject> ObjectClass);
 
+	// Get object from global pool along with a handle for O(1) validation and return
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	UObject* GetPooledObjectWithHandle(TSubclassOf<UObject> ObjectClass, FGWIZPoolHandle& OutHandle);
+
+	// Get several objects of one class from global pool with a single pool lookup
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	int32 GetPooledObjects(TSubclassOf<UObject> ObjectClass, int32 Count, TArray<UObject*>& OutObjects);
+
 	// Return object to global pool
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	void ReturnPooledObject(UObject* Object);
 
+	// Return several objects to global pool, looking up each distinct class's pool once
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	void ReturnPooledObjects(const TArray<UObject*>& Objects);
+
+	// Return object identified by a handle; stale handles are rejected
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	bool ReturnPooledObjectByHandle(TSubclassOf<UObject> ObjectClass, const FGWIZPoolHandle& Handle);
+
 	// Pre-warm all pools
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	void PreWarmAllPools();
 
+	// Queue a pool to be pre-warmed over several frames within PreWarmFrameBudgetMs
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	void QueuePreWarm(TSubclassOf<UObject> ObjectClass, int32 Count);
+
+	// Queue every pool to be pre-warmed to its InitialPoolSize, highest Config.Priority first
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	void QueuePreWarmAllPools();
+
+	// Drop all queued pre-warm work
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	void CancelPreWarm();
+
+	// Whether queued pre-warm work is pending
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pooling")
+	bool IsPreWarming() const;
+
+	// Fraction of queued pre-warm objects created so far (1.0 when idle)
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pooling")
+	float GetPreWarmProgress() const;
+
+	// Milliseconds per frame the pre-warm queue may spend creating objects
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (ClampMin = "0.1"))
+	float PreWarmFrameBudgetMs = 2.0f;
+
+	// Milliseconds per frame spent destroying objects pools have let go of (surplus returns, shrinks)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (ClampMin = "0.1"))
+	float DestroyFrameBudgetMs = 1.0f;
+
+	// Fired after each frame of queued pre-warming
+	UPROPERTY(BlueprintAssignable, Category = "Pooling")
+	FGWIZOnPreWarmProgress OnPreWarmProgress;
+
+	// Fired when the pre-warm queue is empty
+	UPROPERTY(BlueprintAssignable, Category = "Pooling")
+	FGWIZOnPreWarmComplete OnPreWarmComplete;
+
 	// Print all pool statistics
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	void PrintAllPoolStatistics();
@@ -58,14 +163,57 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
 	bool bEnablePerformanceMonitoring = true;
 
-	// Enable/disable thread safety
+	// Enable thread-safe (lock-free) mode on every pool this manager creates; ignored for actor classes
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
 	bool bEnableThreadSafety = false;
 
-	// Enable/disable performance monitoring
+	// Trim pools that have gone unused for AutoCleanupIdleSeconds back to their eviction floor (see EvictionProtectedPriority)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
 	bool bEnableAutoCleanup = true;
 
+	// Seconds a pool must have nothing checked out before auto cleanup trims it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (ClampMin = "0"))
+	float AutoCleanupIdleSeconds = 60.0f;
+
+	// Microseconds per frame spent visiting pools for maintenance (memory sampling, adaptive sizing, auto cleanup,
+	// validation, debug display); one due pool is always visited so maintenance keeps moving
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (ClampMin = "0"))
+	float MaintenanceFrameBudgetUs = 200.0f;
+
+	// Seconds between maintenance visits to the same pool; also the memory budget check interval
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (ClampMin = "0.05"))
+	float MaintenanceIntervalSeconds = 0.5f;
+
+	// Visit due pools in round-robin order until MaintenanceFrameBudgetUs is spent; returns pools visited. Called every Tick
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	int32 RunMaintenance();
+
+	// Grow and shrink pools from observed usage (pools opt out with FGWIZPoolConfig::bEnableAdaptiveSizing)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
+	bool bEnableAdaptiveSizing = true;
+
+	// Sample every pool's usage and apply any resize decisions now; grows go through the pre-warm queue.
+	// Maintenance does the same one pool at a time
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	void UpdateAdaptiveSizing();
+
+	// Memory all pools together may hold before idle objects are evicted (0 = unlimited)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling", meta = (ClampMin = "0"))
+	int64 MemoryBudgetBytes = 0;
+
+	// Optional per-category budgets, keyed by FGWIZPoolConfig::Category; enforced before the global budget
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
+	TMap<FName, int64> CategoryMemoryBudgets;
+
+	// Pools at or above this priority keep their warm set (MinPoolSize or InitialPoolSize idle objects, whichever is larger)
+	// when budgets are enforced; lower-priority pools only keep MinPoolSize
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
+	int32 EvictionProtectedPriority = 8;
+
+	// Evict idle objects, lowest-priority pools first, until every budget is met; returns bytes freed
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	int64 EnforceMemoryBudgets();
+
 	// Get all pools
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	TArray<UGWIZObjectPool*> GetAllPools() const;
@@ -82,14 +230,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	UGWIZObjectPool* GetPoolForClass(TSubclassOf<UObject> ObjectClass) const;
 
-	// Get pools by category
+	// Get pools by category (copy of GetPoolsInCategory, for Blueprint)
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
-	TArray<UGWIZObjectPool*> GetPoolsByCategory(const FString& Category) const;
+	TArray<UGWIZObjectPool*> GetPoolsByCategory(FName Category) const;
 
-	// Get pools by priority
+	// Get pools by priority (copy of GetPoolsAtPriority, for Blueprint)
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	TArray<UGWIZObjectPool*> GetPoolsByPriority(int32 Priority) const;
 
+	// Pools in a category, straight from the index. Game thread only; the view is invalidated when pools are
+	// created, configured or cleared. Change Category and Priority through ConfigurePool so the index follows
+	TConstArrayView<UGWIZObjectPool*> GetPoolsInCategory(FName Category) const;
+
+	// Pools at a priority, straight from the index; same rules as GetPoolsInCategory
+	TConstArrayView<UGWIZObjectPool*> GetPoolsAtPriority(int32 Priority) const;
+
 	// Cleanup unused pools
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	void CleanupUnusedPools();
@@ -106,8 +261,35 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pooling")
 	int32 GetTotalObjectsInUse() const;
 
+	// Get or create a named pool of plain (non-UObject) data; returns nullptr if the name is taken by another type
+	template <typename T, int32 ChunkSize = 64>
+	TGWIZStructPool<T, ChunkSize>* GetStructPool(FName PoolName)
+	{
+		using FPoolType = TGWIZStructPool<T, ChunkSize>;
+
+		FScopeLock Lock(&PoolMutex);
+
+		TUniquePtr<FGWIZStructPoolBase>& Entry = StructPools.FindOrAdd(PoolName);
+		if (!Entry.IsValid())
+		{
+			Entry = MakeUnique<FPoolType>(PoolName);
+		}
+		else if (Entry->GetTypeId() != FPoolType::StaticTypeId())
+		{
+			UE_LOG(LogTemp, Error, TEXT("GWIZPoolingManager::GetStructPool - Pool %s already exists with a different element type"), *PoolName.ToString());
+			return nullptr;
+		}
+
+		return static_cast<FPoolType*>(Entry.Get());
+	}
+
+	// Get struct pool count
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	int32 GetStructPoolCount() const;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void PostInitializeComponents() override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
@@ -116,6 +298,20 @@ private:
 	UPROPERTY()
 	TMap<TSubclassOf<UObject>, UGWIZObjectPool*> Pools;
 
+	// Lookup tables kept in step with Pools; the pools themselves are kept alive by Pools
+	mutable FGWIZPoolRegistry Registry;
+
+	// Guards Registry. Lookups share it, so readers never wait on each other; it is taken exclusively (always
+	// while holding PoolMutex) only to change the registry
+	mutable FRWLock RegistryLock;
+
+	// Pools bucketed by FGWIZPoolConfig::Category and ::Priority, kept in step with Pools
+	TMap<FName, TArray<UGWIZObjectPool*>> PoolsByCategory;
+	TMap<int32, TArray<UGWIZObjectPool*>> PoolsByPriority;
+
+	// Named pools of plain data; not visible to the garbage collector
+	TMap<FName, TUniquePtr<FGWIZStructPoolBase>> StructPools;
+
 	// Default pool configuration
 	UPROPERTY(EditAnywhere, Category = "Pooling")
 	FGWIZPoolConfig DefaultConfig;
@@ -126,4 +322,56 @@ private:
 	// Performance monitoring data
 	TArray<FGWIZPoolStatistics> HistoricalStats;
 
+	// Pending pre-warm requests, sorted by descending priority
+	TArray<FGWIZPreWarmRequest> PreWarmQueue;
+
+	// Objects requested and created since the pre-warm queue last became empty
+	int32 PreWarmObjectsRequested = 0;
+	int32 PreWarmObjectsCreated = 0;
+
+	// Pools in maintenance order; the entry at MaintenanceCursor is always the one visited longest ago
+	TArray<FGWIZMaintenanceEntry> MaintenanceOrder;
+	int32 MaintenanceCursor = 0;
+
+	// Pools with objects waiting to be destroyed, served round-robin from DestroyCursor
+	TArray<UGWIZObjectPool*> PoolsWithPendingDestroys;
+	int32 DestroyCursor = 0;
+
+	// When Tick next checks the memory budgets
+	double NextBudgetCheckTime = 0.0;
+
+	// Whether the last budget check left the manager over MemoryBudgetBytes; stops unprotected pools growing
+	bool bOverMemoryBudget = false;
+
+	// One maintenance visit; caller must hold PoolMutex
+	void MaintainPool(FGWIZMaintenanceEntry& Entry, double Now);
+
+	// Evaluate one pool's adaptive size and apply the decision; caller must hold PoolMutex
+	void ApplyAdaptiveSizing(UGWIZObjectPool* Pool, double Now, bool bOverBudget);
+
+	// Spend up to PreWarmFrameBudgetMs working through the pre-warm queue
+	void ProcessPreWarmQueue();
+
+	// Spend up to DestroyFrameBudgetMs destroying objects queued by the pools, continuing from where the last frame stopped
+	void ProcessPendingDestroys();
+
+	// Bound to every pool's OnDestroyQueued
+	void HandleDestroyQueued(UGWIZObjectPool* Pool);
+
+	// Rebuild the registry from Pools, dropping every cached class resolution; caller must hold PoolMutex
+	void RebuildRegistry();
+
+	// File a pool under, or remove it from, the category and priority buckets; caller must hold PoolMutex
+	void IndexPool(UGWIZObjectPool* Pool);
+	void UnindexPool(UGWIZObjectPool* Pool, FName Category, int32 Priority);
+
+	// Add or extend a queued request for a pool; caller must hold PoolMutex
+	void EnqueuePreWarm(UGWIZObjectPool* Pool, int32 Count);
+
+	// Evict up to BytesToFree from pools in EvictionOrder; BudgetName (NAME_None for global) is for logging. Caller must hold PoolMutex
+	int64 EvictIdleMemory(TConstArrayView<UGWIZObjectPool*> EvictionOrder, int64 BytesToFree, FName BudgetName);
+
+	// Idle objects a pool keeps no matter how far over budget the manager is
+	int32 GetEvictionFloor(const UGWIZObjectPool* Pool) const;
+
 };
@@ -0,0 +1,73 @@
+// Copyright (c) 2024 Groove Wizard, Inc. All Rights Reserved.
+// This code is part of the GWIZ Generic Pooling System for Unreal Engine.
+
+#include "GWIZPoolingSubsystem.h"
+#include "GWIZPoolingManager.h"
+#include "Engine/World.h"
+
+void UGWIZPoolingSubsystem::Deinitialize()
+{
+    // The manager is an actor of this world and is torn down with it
+    Manager = nullptr;
+
+    Super::Deinitialize();
+}
+
+AGWIZPoolingManager* UGWIZPoolingSubsystem::GetManager()
+{
+    if (IsValid(Manager))
+    {
+        return Manager;
+    }
+
+    UWorld* World = GetWorld();
+    if (World == nullptr || !IsInGameThread())
+    {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    SpawnParams.ObjectFlags |= RF_Transient;
+
+    // The new manager registers itself from PostInitializeComponents
+    AGWIZPoolingManager* NewManager = World->SpawnActor<AGWIZPoolingManager>(AGWIZPoolingManager::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+    if (NewManager == nullptr)
+    {
+        UE_LOG(LogTemp, Error, TEXT("GWIZPoolingSubsystem::GetManager - Failed to spawn pooling manager in %s"), *World->GetName());
+        return nullptr;
+    }
+
+    return Manager;
+}
+
+AGWIZPoolingManager* UGWIZPoolingSubsystem::FindManager() const
+{
+    return IsValid(Manager) ? Manager : nullptr;
+}
+
+bool UGWIZPoolingSubsystem::RegisterManager(AGWIZPoolingManager* InManager)
+{
+    if (IsValid(Manager) && Manager != InManager)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("GWIZPoolingSubsystem::RegisterManager - %s already has pooling manager %s; %s will not be used by GetPoolingManager"),
+               *GetWorld()->GetName(), *Manager->GetName(), *InManager->GetName());
+        return false;
+    }
+
+    Manager = InManager;
+    return true;
+}
+
+void UGWIZPoolingSubsystem::UnregisterManager(AGWIZPoolingManager* InManager)
+{
+    if (Manager == InManager)
+    {
+        Manager = nullptr;
+    }
+}
+
+bool UGWIZPoolingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
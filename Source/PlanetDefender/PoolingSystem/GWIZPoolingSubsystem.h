@@ -0,0 +1,64 @@
+// Copyright (c) 2024 Groove Wizard, Inc. All Rights Reserved.
+// This code is part of the GWIZ Generic Pooling System for Unreal Engine.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GWIZPoolingSubsystem.generated.h"
+
+class AGWIZPoolingManager;
+
+/**
+ * Owns the pooling manager of one game or PIE world.
+ * Each world gets its own manager, so PIE sessions and automation tests that run several worlds never share pools.
+ * Looking the manager up is a subsystem lookup on the world and takes no lock.
+ */
+UCLASS()
+class PLANETDEFENDER_API UGWIZPoolingSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    //~ Begin UWorldSubsystem Interface
+    virtual void Deinitialize() override;
+    //~ End UWorldSubsystem Interface
+
+    /**
+     * Get the world's pooling manager, spawning one on first use if the level does not place one.
+     * Spawning only happens on the game thread; other threads get nullptr until a manager exists.
+     * @return Pooling manager, or nullptr if none exists and one could not be spawned
+     */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling")
+    AGWIZPoolingManager* GetManager();
+
+    /**
+     * Get the world's pooling manager without spawning one.
+     * @return Pooling manager, or nullptr if none exists yet
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "GWIZ Pooling")
+    AGWIZPoolingManager* FindManager() const;
+
+    /**
+     * Called by managers as they are initialized; the first manager in a world wins.
+     * @param InManager Manager to register
+     * @return false if the world already has a different manager
+     */
+    bool RegisterManager(AGWIZPoolingManager* InManager);
+
+    /**
+     * Called by managers as they leave play.
+     * @param InManager Manager to unregister; ignored unless it is the registered one
+     */
+    void UnregisterManager(AGWIZPoolingManager* InManager);
+
+protected:
+    //~ Begin UWorldSubsystem Interface
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    //~ End UWorldSubsystem Interface
+
+private:
+    /** The world's manager; placed in the level or spawned by GetManager */
+    UPROPERTY()
+    AGWIZPoolingManager* Manager = nullptr;
+};
@@ -0,0 +1,313 @@
+// Copyright (c) 2024 Groove Wizard, Inc. All Rights Reserved.
+// This code is part of the GWIZ Generic Pooling System for Unreal Engine.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "PoolingTypes.h"
+
+/**
+ * Type-erased base for struct pools, so a pooling manager can own and report pools of different types.
+ */
+class FGWIZStructPoolBase
+{
+public:
+    explicit FGWIZStructPoolBase(FName InPoolName)
+        : PoolName(InPoolName)
+    {
+    }
+
+    virtual ~FGWIZStructPoolBase() = default;
+
+    FGWIZStructPoolBase(const FGWIZStructPoolBase&) = delete;
+    FGWIZStructPoolBase& operator=(const FGWIZStructPoolBase&) = delete;
+
+    /** Name the pool was registered under */
+    FName GetPoolName() const { return PoolName; }
+
+    /** Identifies the element type; equal for pools of the same T */
+    virtual const void* GetTypeId() const = 0;
+
+    /** Pool statistics, in the same shape as UGWIZObjectPool's */
+    virtual FGWIZPoolStatistics GetStatistics() const = 0;
+
+    /** Free chunks that hold no live elements */
+    virtual void TrimUnusedChunks() = 0;
+
+protected:
+    FName PoolName;
+};
+
+/**
+ * Pool for plain (non-UObject) gameplay data such as projectile kinematics or damage events.
+ * Elements live in fixed-size, cache-line aligned chunks that never move, so pointers stay valid
+ * until the element is released. Elements are constructed in place on Acquire and destroyed on Release;
+ * callers hold generation-checked FGWIZPoolHandles, and stale handles resolve to nullptr.
+ * Nothing here is visible to the garbage collector, so T must not own UObject references.
+ * Not thread-safe; use from one thread.
+ *
+ * @tparam T Element type
+ * @tparam ChunkSize Elements per chunk
+ */
+template <typename T, int32 ChunkSize = 64>
+class TGWIZStructPool final : public FGWIZStructPoolBase
+{
+    static_assert(ChunkSize > 0, "TGWIZStructPool chunk size must be positive");
+    static_assert(!TIsDerivedFrom<T, UObject>::Value, "TGWIZStructPool is for plain data; use UGWIZObjectPool for UObjects");
+
+public:
+    explicit TGWIZStructPool(FName InPoolName = NAME_None)
+        : FGWIZStructPoolBase(InPoolName)
+    {
+    }
+
+    virtual ~TGWIZStructPool() override
+    {
+        Reset();
+    }
+
+    /**
+     * Construct an element in place.
+     * @param Args Constructor arguments for T
+     * @return Handle to the new element
+     */
+    template <typename... ArgTypes>
+    FGWIZPoolHandle Acquire(ArgTypes&&... Args)
+    {
+        if (FreeIndices.Num() > 0)
+        {
+            ++Statistics.PoolHits;
+        }
+        else
+        {
+            AddChunk();
+            ++Statistics.PoolMisses;
+        }
+
+        const int32 Index = FreeIndices.Pop(EAllowShrinking::No);
+        new (GetElementAddress(Index)) T(Forward<ArgTypes>(Args)...);
+
+        FSlotInfo& Slot = SlotInfos[Index];
+        Slot.bAlive = true;
+        ++LiveCount;
+        Statistics.PeakConcurrentUsage = FMath::Max(Statistics.PeakConcurrentUsage, LiveCount);
+
+        return FGWIZPoolHandle(Index, Slot.Generation);
+    }
+
+    /**
+     * Destroy an element and make its slot available again.
+     * @param Handle Handle returned by Acquire
+     * @return false if the handle was stale
+     */
+    bool Release(const FGWIZPoolHandle& Handle)
+    {
+        if (!IsValid(Handle))
+        {
+            return false;
+        }
+
+        DestroyElement(Handle.SlotIndex);
+        FreeIndices.Add(Handle.SlotIndex);
+        return true;
+    }
+
+    /** Whether a handle still refers to a live element */
+    bool IsValid(const FGWIZPoolHandle& Handle) const
+    {
+        return SlotInfos.IsValidIndex(Handle.SlotIndex)
+            && SlotInfos[Handle.SlotIndex].bAlive
+            && SlotInfos[Handle.SlotIndex].Generation == Handle.Generation;
+    }
+
+    /**
+     * Resolve a handle.
+     * @return Element, or nullptr if the handle is stale
+     */
+    T* Get(const FGWIZPoolHandle& Handle)
+    {
+        return IsValid(Handle) ? GetElementAddress(Handle.SlotIndex) : nullptr;
+    }
+
+    const T* Get(const FGWIZPoolHandle& Handle) const
+    {
+        return IsValid(Handle) ? GetElementAddress(Handle.SlotIndex) : nullptr;
+    }
+
+    /**
+     * Make sure at least Count elements can be acquired without allocating.
+     * @param Count Number of free elements wanted
+     */
+    void Reserve(int32 Count)
+    {
+        while (FreeIndices.Num() < Count)
+        {
+            AddChunk();
+        }
+    }
+
+    /**
+     * Call Func(T&) for every live element, in chunk order.
+     */
+    template <typename FuncType>
+    void ForEachLive(FuncType&& Func)
+    {
+        for (int32 Index = 0; Index < SlotInfos.Num(); ++Index)
+        {
+            if (SlotInfos[Index].bAlive)
+            {
+                Func(*GetElementAddress(Index));
+            }
+        }
+    }
+
+    /** Destroy every live element and free all chunks. Outstanding handles become stale. */
+    void Reset()
+    {
+        for (int32 Index = 0; Index < SlotInfos.Num(); ++Index)
+        {
+            if (SlotInfos[Index].bAlive)
+            {
+                DestroyElement(Index);
+            }
+            RetiredGeneration = FMath::Max(RetiredGeneration, SlotInfos[Index].Generation);
+        }
+
+        for (T* Chunk : Chunks)
+        {
+            FMemory::Free(Chunk);
+        }
+
+        Chunks.Empty();
+        SlotInfos.Empty();
+        FreeIndices.Empty();
+    }
+
+    /** Number of live elements */
+    int32 Num() const { return LiveCount; }
+
+    /** Number of elements that can be held without allocating */
+    int32 Capacity() const { return SlotInfos.Num(); }
+
+    //~ Begin FGWIZStructPoolBase Interface
+    virtual const void* GetTypeId() const override { return StaticTypeId(); }
+
+    virtual FGWIZPoolStatistics GetStatistics() const override
+    {
+        FGWIZPoolStatistics Result = Statistics;
+        Result.CurrentPoolSize = FreeIndices.Num();
+        Result.ObjectsInUse = LiveCount;
+        Result.TotalObjectsCreated = SlotInfos.Num();
+        Result.MemoryUsage = static_cast<int64>(Chunks.Num()) * ChunkSize * sizeof(T)
+                           + SlotInfos.GetAllocatedSize() + FreeIndices.GetAllocatedSize() + Chunks.GetAllocatedSize();
+        Result.LastUpdateTime = FPlatformTime::Seconds();
+        Result.CalculateHitRate();
+        return Result;
+    }
+
+    virtual void TrimUnusedChunks() override
+    {
+        // Only trailing chunks can go, since slot indices encode chunk positions
+        while (Chunks.Num() > 0)
+        {
+            const int32 FirstIndex = (Chunks.Num() - 1) * ChunkSize;
+            for (int32 Index = FirstIndex; Index < SlotInfos.Num(); ++Index)
+            {
+                if (SlotInfos[Index].bAlive)
+                {
+                    return;
+                }
+            }
+
+            // Handles into the trimmed slots must never match the slots that replace them
+            for (int32 Index = FirstIndex; Index < SlotInfos.Num(); ++Index)
+            {
+                RetiredGeneration = FMath::Max(RetiredGeneration, SlotInfos[Index].Generation);
+            }
+
+            FreeIndices.RemoveAll([FirstIndex](int32 Index) { return Index >= FirstIndex; });
+            SlotInfos.SetNum(FirstIndex, EAllowShrinking::No);
+            FMemory::Free(Chunks.Pop(EAllowShrinking::No));
+        }
+    }
+    //~ End FGWIZStructPoolBase Interface
+
+    /**
+     * Identifies TGWIZStructPool<T, ChunkSize> without RTTI. The tag is writable on purpose: identical read-only
+     * constants may be folded into one address by the linker (e.g. /OPT:ICF), which would give different T the same id.
+     */
+    static const void* StaticTypeId()
+    {
+        static uint8 TypeTag = 0;
+        return &TypeTag;
+    }
+
+private:
+    /** Per-element bookkeeping, kept apart from the elements so iteration over T stays dense */
+    struct FSlotInfo
+    {
+        /** Bumped on release; starts at 1 so default handles never match */
+        int32 Generation = 1;
+
+        /** Whether the element is constructed */
+        bool bAlive = false;
+    };
+
+    T* GetElementAddress(int32 Index) const
+    {
+        return Chunks[Index / ChunkSize] + (Index % ChunkSize);
+    }
+
+    void AddChunk()
+    {
+        constexpr SIZE_T Alignment = alignof(T) > PLATFORM_CACHE_LINE_SIZE ? alignof(T) : PLATFORM_CACHE_LINE_SIZE;
+        T* Chunk = static_cast<T*>(FMemory::Malloc(sizeof(T) * ChunkSize, Alignment));
+        Chunks.Add(Chunk);
+
+        const int32 FirstIndex = SlotInfos.Num();
+        SlotInfos.AddDefaulted(ChunkSize);
+        if (RetiredGeneration > 0)
+        {
+            for (int32 Index = FirstIndex; Index < SlotInfos.Num(); ++Index)
+            {
+                SlotInfos[Index].Generation = RetiredGeneration + 1;
+            }
+        }
+
+        // Push in reverse so the lowest index is handed out first
+        FreeIndices.Reserve(FreeIndices.Num() + ChunkSize);
+        for (int32 Index = FirstIndex + ChunkSize - 1; Index >= FirstIndex; --Index)
+        {
+            FreeIndices.Add(Index);
+        }
+    }
+
+    void DestroyElement(int32 Index)
+    {
+        GetElementAddress(Index)->~T();
+
+        FSlotInfo& Slot = SlotInfos[Index];
+        Slot.bAlive = false;
+        Slot.Generation = Slot.Generation == MAX_int32 ? 1 : Slot.Generation + 1;
+        --LiveCount;
+    }
+
+    /** Chunk base pointers; chunks never move once allocated */
+    TArray<T*> Chunks;
+
+    /** Bookkeeping per element, indexed like the elements */
+    TArray<FSlotInfo> SlotInfos;
+
+    /** Free element indices (used as a stack) */
+    TArray<int32> FreeIndices;
+
+    /** Number of constructed elements */
+    int32 LiveCount = 0;
+
+    /** Highest generation of any slot removed by TrimUnusedChunks */
+    int32 RetiredGeneration = 0;
+
+    /** Hit/miss and peak counters; size fields are filled in by GetStatistics */
+    FGWIZPoolStatistics Statistics;
+};
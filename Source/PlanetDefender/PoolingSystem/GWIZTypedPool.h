@@ -0,0 +1,164 @@
+// Copyright (c) 2024 Groove Wizard, Inc. All Rights Reserved.
+// This code is part of the GWIZ Generic Pooling System for Unreal Engine.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GWIZObjectPool.h"
+
+/**
+ * Satisfied by classes that declare non-virtual C++ lifecycle hooks:
+ *     void NativeOnPooled();
+ *     void NativeOnUnpooled();
+ * TGWIZTypedPool calls these directly instead of dispatching IGWIZPoolable through reflection.
+ */
+template <typename T>
+concept CGWIZNativePoolable = requires(T& Object)
+{
+    Object.NativeOnPooled();
+    Object.NativeOnUnpooled();
+};
+
+/**
+ * Typed C++ view of a UGWIZObjectPool. Returns T* without a Cast and chooses lifecycle dispatch at
+ * compile time: classes satisfying CGWIZNativePoolable have their hooks called directly, everything else
+ * goes through the pool's cached IGWIZPoolable dispatch. The view does not own the pool; the pool must
+ * outlive it (pools created by AGWIZPoolingManager live as long as the manager).
+ *
+ * @tparam T UObject class stored in the pool; the pool's class must be T or a subclass of it
+ */
+template <typename T>
+class TGWIZTypedPool
+{
+    static_assert(TIsDerivedFrom<T, UObject>::Value, "TGWIZTypedPool requires a UObject type; use TGWIZStructPool for plain data");
+
+public:
+    TGWIZTypedPool() = default;
+
+    explicit TGWIZTypedPool(UGWIZObjectPool* InPool)
+        : Pool(InPool)
+    {
+        if (Pool && !Pool->GetPooledObjectClass())
+        {
+            Pool->SetPooledObjectClass(T::StaticClass());
+        }
+        checkf(!Pool || Pool->GetPooledObjectClass()->IsChildOf(T::StaticClass()),
+               TEXT("TGWIZTypedPool<%s> bound to a pool of %s"), *T::StaticClass()->GetName(), *Pool->GetPooledObjectClass()->GetName());
+    }
+
+    /** Whether T's lifecycle hooks are bound at compile time */
+    static constexpr bool HasNativeHooks() { return CGWIZNativePoolable<T>; }
+
+    /**
+     * Get an object from the pool.
+     * @return Object, or nullptr if the view is unbound or creation failed
+     */
+    T* Acquire()
+    {
+        FGWIZPoolHandle Handle;
+        return Pool ? static_cast<T*>(Pool->GetObjectWithHook(Pool->GetPooledObjectClass(), Handle, GetOnPooledHook())) : nullptr;
+    }
+
+    /**
+     * Get an object from the pool together with its handle.
+     * Thread-safe pools do not issue handles: OutHandle stays unset and the object must be returned with Release(T*).
+     * @param OutHandle Handle for the checked out object (reset if no object was returned)
+     * @return Object, or nullptr if the view is unbound or creation failed
+     */
+    T* Acquire(FGWIZPoolHandle& OutHandle)
+    {
+        if (!Pool)
+        {
+            OutHandle.Reset();
+            return nullptr;
+        }
+        T* Object = static_cast<T*>(Pool->GetObjectWithHook(Pool->GetPooledObjectClass(), OutHandle, GetOnPooledHook()));
+        if (Object && Pool->IsThreadSafe())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] TGWIZTypedPool<%s>::Acquire: Thread-safe pools do not issue handles; return %s with Release(T*)"),
+                   *T::StaticClass()->GetName(), *Object->GetName());
+        }
+        return Object;
+    }
+
+    /**
+     * Return an object to the pool.
+     * @param Object Object to return
+     * @return false if the object was rejected
+     */
+    bool Release(T* Object)
+    {
+        return Pool && Pool->ReturnObjectWithHook(Object, GetOnUnpooledHook());
+    }
+
+    /**
+     * Return the object identified by a handle. Not supported by thread-safe pools, which never issue handles.
+     * @param Handle Handle obtained from Acquire
+     * @return false if the handle was stale or the pool is thread-safe
+     */
+    bool Release(const FGWIZPoolHandle& Handle)
+    {
+        if (Pool && Pool->IsThreadSafe())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[GWIZ Pool] TGWIZTypedPool<%s>::Release: Thread-safe pools do not issue handles; use Release(T*)"),
+                   *T::StaticClass()->GetName());
+            return false;
+        }
+        return Pool && Pool->ReturnObjectByHandleWithHook(Handle, GetOnUnpooledHook());
+    }
+
+    /**
+     * Resolve a handle.
+     * @return Object, or nullptr if the handle is stale
+     */
+    T* Resolve(const FGWIZPoolHandle& Handle) const
+    {
+        return Pool ? static_cast<T*>(Pool->ResolveHandle(Handle)) : nullptr;
+    }
+
+    /** Underlying pool, for configuration and statistics */
+    UGWIZObjectPool* GetPool() const { return Pool; }
+
+    /** Whether the view is bound to a pool */
+    bool IsValid() const { return Pool != nullptr; }
+
+    explicit operator bool() const { return IsValid(); }
+
+private:
+    static void CallOnPooled(UObject* Object)
+    {
+        static_cast<T*>(Object)->NativeOnPooled();
+    }
+
+    static void CallOnUnpooled(UObject* Object)
+    {
+        static_cast<T*>(Object)->NativeOnUnpooled();
+    }
+
+    static constexpr FGWIZLifecycleHook GetOnPooledHook()
+    {
+        if constexpr (CGWIZNativePoolable<T>)
+        {
+            return &CallOnPooled;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    static constexpr FGWIZLifecycleHook GetOnUnpooledHook()
+    {
+        if constexpr (CGWIZNativePoolable<T>)
+        {
+            return &CallOnUnpooled;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    /** Pool this view forwards to */
+    UGWIZObjectPool* Pool = nullptr;
+};
@@ -4,8 +4,37 @@
 
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
+#include <atomic>
 #include "PoolingTypes.generated.h"
 
+/**
+ * Steps a pool runs when an object is checked out (activation) or returned (deactivation).
+ * Combined as a bitmask in FGWIZPoolConfig::ActivationSteps.
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EGWIZPoolActivationStep : uint8
+{
+    None                = 0 UMETA(Hidden),
+    /** Enable actor tick on checkout, disable on return */
+    Tick                = 1 << 0,
+    /** Show the actor on checkout, hide on return */
+    Visibility          = 1 << 1,
+    /** Enable actor collision on checkout, disable on return */
+    Collision           = 1 << 2,
+    /** Move the actor back to the origin on return (off by default; it triggers transform and overlap updates) */
+    TransformReset      = 1 << 3,
+    /** Activate auto-activating components on checkout, deactivate all components on return */
+    ComponentActivation = 1 << 4,
+    /** Call IGWIZPoolable::OnPooled / OnUnpooled */
+    InterfaceCallbacks  = 1 << 5
+};
+ENUM_CLASS_FLAGS(EGWIZPoolActivationStep);
+
+/** Activation steps used by pools unless configured otherwise */
+constexpr int32 GWIZDefaultPoolActivationSteps =
+    static_cast<int32>(EGWIZPoolActivationStep::Tick | EGWIZPoolActivationStep::Visibility | EGWIZPoolActivationStep::Collision |
+                       EGWIZPoolActivationStep::InterfaceCallbacks);
+
 /**
  * Configuration structure for pool settings.
  * Configurable per object type with sensible defaults.
@@ -25,6 +54,14 @@ public:
         , bEnableThreadSafety(false)
         , Category(TEXT("Default"))
         , Priority(5)
+        , ActivationSteps(GWIZDefaultPoolActivationSteps)
+        , bDeepParkActors(false)
+        , ThreadCacheMagazineSize(0)
+        , bEnableAdaptiveSizing(true)
+        , AdaptiveWindowSeconds(10.0f)
+        , AdaptiveHeadroom(0.25f)
+        , AdaptiveShrinkDelaySeconds(30.0f)
+        , MemoryRefreshIntervalSeconds(30.0f)
     {
     }
 
@@ -48,18 +85,65 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling")
     bool bEnableMonitoring;
 
-    /** Whether to enable thread safety features */
+    /** Whether GetObject/ReturnObject may be called from any thread (non-actor classes only; see UGWIZObjectPool::IsThreadSafe) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling")
     bool bEnableThreadSafety;
 
-    /** Category for organizing pools (e.g., "Projectiles", "Effects", "UI") */
+    /** Category for organizing pools (e.g., "Projectiles", "Effects", "UI"); names compare case-insensitively */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling")
-    FString Category;
+    FName Category;
 
     /** Priority level for pool management (higher = more important) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling", meta = (ClampMin = "0", ClampMax = "10"))
     int32 Priority;
 
+    /** Which activation/deactivation steps the pool runs on checkout and return (EGWIZPoolActivationStep flags) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling", meta = (Bitmask, BitmaskEnum = "/Script/PlanetDefender.EGWIZPoolActivationStep"))
+    int32 ActivationSteps;
+
+    /**
+     * Whether idle actors have their profiled components unregistered while in the pool,
+     * taking them out of the scene, physics scene and tick lists until checked out again
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling")
+    bool bDeepParkActors;
+
+    /**
+     * Objects per magazine in the per-thread cache used in thread-safe mode (0 disables the cache).
+     * Each thread keeps up to two magazines locally and exchanges whole magazines with the shared pool.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling", meta = (ClampMin = "0", ClampMax = "1024"))
+    int32 ThreadCacheMagazineSize;
+
+    /** Whether the pooling manager may grow and shrink this pool between MinPoolSize and MaxPoolSize from observed usage */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling|Adaptive Sizing")
+    bool bEnableAdaptiveSizing;
+
+    /** Length of the sliding window over which peak usage and misses are observed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling|Adaptive Sizing", meta = (ClampMin = "0.5", Units = "s"))
+    float AdaptiveWindowSeconds;
+
+    /**
+     * Spare capacity kept above the window's peak usage, as a fraction of it.
+     * The pool grows when it drops below peak * (1 + headroom) and may shrink once above peak * (1 + 2 * headroom).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling|Adaptive Sizing", meta = (ClampMin = "0.0", ClampMax = "4.0"))
+    float AdaptiveHeadroom;
+
+    /** How long the pool must stay over-provisioned, with no misses, before it is shrunk */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling|Adaptive Sizing", meta = (ClampMin = "0.0", Units = "s"))
+    float AdaptiveShrinkDelaySeconds;
+
+    /** How often the measured per-instance memory of each pooled class is refreshed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GWIZ Pooling", meta = (ClampMin = "1.0", Units = "s"))
+    float MemoryRefreshIntervalSeconds;
+
+    /** Check whether an activation step is enabled */
+    bool HasActivationStep(EGWIZPoolActivationStep Step) const
+    {
+        return (ActivationSteps & static_cast<int32>(Step)) != 0;
+    }
+
     /** Validate configuration values */
     bool IsValid() const
     {
@@ -91,6 +175,11 @@ public:
         , AverageLifetime(0.0f)
         , PeakConcurrentUsage(0)
         , LastUpdateTime(0.0f)
+        , LocalCacheHits(0)
+        , LifetimeP50(0.0f)
+        , LifetimeP95(0.0f)
+        , LifetimeP99(0.0f)
+        , OldestOutstandingAge(0.0f)
     {
     }
 
@@ -122,7 +211,7 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
     int64 MemoryUsage;
 
-    /** Average object lifetime in seconds */
+    /** Average time in seconds objects stayed checked out, over all returns */
     UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
     float AverageLifetime;
 
@@ -134,6 +223,26 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
     float LastUpdateTime;
 
+    /** Acquires and releases served by a per-thread cache without touching shared pool state */
+    UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
+    int32 LocalCacheHits;
+
+    /** Median checkout duration in seconds */
+    UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
+    float LifetimeP50;
+
+    /** 95th percentile checkout duration in seconds */
+    UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
+    float LifetimeP95;
+
+    /** 99th percentile checkout duration in seconds */
+    UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
+    float LifetimeP99;
+
+    /** How long the longest-held object currently checked out has been out, in seconds */
+    UPROPERTY(BlueprintReadOnly, Category = "GWIZ Pooling")
+    float OldestOutstandingAge;
+
     /** Calculate hit rate based on hits and misses */
     void CalculateHitRate()
     {
@@ -160,9 +269,541 @@ public:
         AverageLifetime = 0.0f;
         PeakConcurrentUsage = 0;
         LastUpdateTime = 0.0f;
+        LocalCacheHits = 0;
+        LifetimeP50 = 0.0f;
+        LifetimeP95 = 0.0f;
+        LifetimeP99 = 0.0f;
+        OldestOutstandingAge = 0.0f;
+    }
+};
+
+/**
+ * Lightweight reference to an object checked out of a pool.
+ * A handle stays valid until the object is returned; returning bumps the slot's generation,
+ * so stale copies of the handle are rejected in constant time.
+ */
+USTRUCT(BlueprintType)
+struct PLANETDEFENDER_API FGWIZPoolHandle
+{
+    GENERATED_BODY()
+
+public:
+    FGWIZPoolHandle()
+        : SlotIndex(INDEX_NONE)
+        , Generation(0)
+    {
+    }
+
+    FGWIZPoolHandle(int32 InSlotIndex, int32 InGeneration)
+        : SlotIndex(InSlotIndex)
+        , Generation(InGeneration)
+    {
+    }
+
+    /** Index of the pool slot holding the object */
+    UPROPERTY()
+    int32 SlotIndex;
+
+    /** Slot generation at the time the object was checked out */
+    UPROPERTY()
+    int32 Generation;
+
+    /** Whether this handle was ever assigned (it may still be stale) */
+    bool IsSet() const
+    {
+        return SlotIndex != INDEX_NONE;
+    }
+
+    /** Clear the handle */
+    void Reset()
+    {
+        SlotIndex = INDEX_NONE;
+        Generation = 0;
+    }
+
+    bool operator==(const FGWIZPoolHandle& Other) const
+    {
+        return SlotIndex == Other.SlotIndex && Generation == Other.Generation;
+    }
+
+    bool operator!=(const FGWIZPoolHandle& Other) const
+    {
+        return !(*this == Other);
+    }
+
+    friend uint32 GetTypeHash(const FGWIZPoolHandle& Handle)
+    {
+        return HashCombine(::GetTypeHash(Handle.SlotIndex), ::GetTypeHash(Handle.Generation));
+    }
+};
+
+/**
+ * Bookkeeping entry for a single object owned by a pool.
+ * Slots never move, so an object keeps the same slot index for as long as it belongs to the pool.
+ */
+USTRUCT()
+struct PLANETDEFENDER_API FGWIZPoolSlot
+{
+    GENERATED_BODY()
+
+public:
+    FGWIZPoolSlot()
+        : Object(nullptr)
+        , ListIndex(INDEX_NONE)
+        , Generation(1)
+        , bInUse(false)
+        , bDeepParked(false)
+        , CheckoutCycles(0)
+    {
+    }
+
+    /** Object stored in this slot (nullptr when the slot is vacant) */
+    UPROPERTY()
+    UObject* Object;
+
+    /** Position of this slot inside the pool's available or in-use list */
+    int32 ListIndex;
+
+    /** Incremented every time the slot's object is returned or removed, invalidating old handles */
+    int32 Generation;
+
+    /** Whether the object is currently checked out of the pool */
+    bool bInUse;
+
+    /** Whether the actor's profiled components are currently unregistered */
+    bool bDeepParked;
+
+    /** Actor components matching the class component profile, in profile order (actors only) */
+    TArray<TWeakObjectPtr<UActorComponent>> Components;
+
+    /** FPlatformTime::Cycles64() at checkout, or 0 if the object was adopted rather than checked out */
+    uint64 CheckoutCycles;
+};
+
+/**
+ * Fixed-size histogram of durations with logarithmic buckets: four buckets per power of two of microseconds,
+ * so every bucket is within 25% of its neighbours' width. Covers 1 microsecond to about 2 hours in 512 bytes.
+ */
+struct FGWIZLifetimeHistogram
+{
+    static constexpr int32 SubBucketBits = 2;
+    static constexpr int32 SubBuckets = 1 << SubBucketBits;
+    static constexpr int32 NumBuckets = 128;
+
+    /** Number of samples per bucket */
+    uint32 Buckets[NumBuckets] = {};
+
+    /** Total number of samples */
+    uint64 Count = 0;
+
+    /** Sum of all samples, for the mean */
+    double TotalSeconds = 0.0;
+
+    /** Record one duration */
+    void Add(double Seconds)
+    {
+        const uint64 Microseconds = static_cast<uint64>(FMath::Max(0.0, Seconds) * 1.0e6);
+        ++Buckets[GetBucketIndex(Microseconds)];
+        ++Count;
+        TotalSeconds += Seconds;
+    }
+
+    /** Mean of all samples in seconds */
+    double GetMean() const
+    {
+        return Count > 0 ? TotalSeconds / static_cast<double>(Count) : 0.0;
+    }
+
+    /**
+     * Estimate a percentile from the bucket counts.
+     * @param Fraction Percentile as a fraction (0.5 for the median)
+     * @return Midpoint of the bucket holding the percentile, in seconds
+     */
+    double GetPercentile(double Fraction) const
+    {
+        if (Count == 0)
+        {
+            return 0.0;
+        }
+
+        const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Fraction, 0.0, 1.0) * Count)));
+        uint64 Seen = 0;
+        for (int32 Index = 0; Index < NumBuckets; ++Index)
+        {
+            Seen += Buckets[Index];
+            if (Seen >= Rank)
+            {
+                return 0.5 * (GetBucketLowerBound(Index) + GetBucketLowerBound(Index + 1)) * 1.0e-6;
+            }
+        }
+        return GetBucketLowerBound(NumBuckets) * 1.0e-6;
+    }
+
+    /** Clear all samples */
+    void Reset()
+    {
+        *this = FGWIZLifetimeHistogram();
+    }
+
+    /** Bucket for a duration; values below SubBuckets microseconds get one bucket each */
+    static int32 GetBucketIndex(uint64 Microseconds)
+    {
+        if (Microseconds < SubBuckets)
+        {
+            return static_cast<int32>(Microseconds);
+        }
+
+        const int32 Octave = static_cast<int32>(FMath::FloorLog2_64(Microseconds));
+        const int32 SubBucket = static_cast<int32>((Microseconds >> (Octave - SubBucketBits)) & (SubBuckets - 1));
+        return FMath::Min((Octave - SubBucketBits + 1) * SubBuckets + SubBucket, NumBuckets - 1);
+    }
+
+    /** Smallest duration in microseconds that falls into a bucket (Index may be NumBuckets for the upper bound) */
+    static double GetBucketLowerBound(int32 Index)
+    {
+        if (Index < SubBuckets)
+        {
+            return static_cast<double>(Index);
+        }
+
+        const int32 Octave = Index / SubBuckets + SubBucketBits - 1;
+        const int32 SubBucket = Index % SubBuckets;
+        return FMath::Pow(2.0, static_cast<double>(Octave - SubBucketBits)) * static_cast<double>(SubBuckets + SubBucket);
     }
 };
 
+/**
+ * Cached per-class memory figures used for incremental memory accounting.
+ * Lets a pool keep its memory total up to date without walking its objects.
+ */
+struct FGWIZClassMemoryInfo
+{
+    FGWIZClassMemoryInfo()
+        : ObjectSize(0)
+        , ObjectCount(0)
+        , MeasuredTime(0.0)
+    {
+    }
+
+    /** Measured size of one instance in bytes, including its components and other subobjects */
+    int64 ObjectSize;
+
+    /** Number of instances of this class currently owned by the pool */
+    int32 ObjectCount;
+
+    /** When ObjectSize was last measured (FPlatformTime::Seconds) */
+    double MeasuredTime;
+};
+
+/**
+ * Fixed-size batch of free objects exchanged between per-thread caches and a thread-safe pool.
+ */
+struct FGWIZObjectMagazine
+{
+    /** Free objects; the owning pool's slots keep them alive */
+    TArray<UObject*> Objects;
+};
+
+/**
+ * One thread's cache of free objects for a thread-safe pool.
+ * Only the owning thread writes; the counters are atomics so the game thread can read them for statistics.
+ */
+struct FGWIZThreadCache
+{
+    FGWIZThreadCache()
+        : CachedCount(0)
+        , NetCheckouts(0)
+        , LocalAcquires(0)
+        , LocalReleases(0)
+    {
+    }
+
+    /** Free objects held by this thread */
+    TArray<UObject*> Objects;
+
+    /** Mirror of Objects.Num() */
+    std::atomic<int32> CachedCount;
+
+    /** Objects acquired minus objects released through this cache */
+    std::atomic<int32> NetCheckouts;
+
+    /** Acquires served from Objects without a refill */
+    std::atomic<int32> LocalAcquires;
+
+    /** Releases absorbed by Objects without a flush */
+    std::atomic<int32> LocalReleases;
+
+    /** Increment a counter only this thread writes, without a locked read-modify-write */
+    static void Bump(std::atomic<int32>& Counter, int32 Delta)
+    {
+        Counter.store(Counter.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Checked-out flag for every object owned by a thread-safe pool, indexed by UObject unique id so any thread can
+ * flip it with one compare-and-swap instead of looking up the object's slot.
+ * Pages are added by the pool under its mutex when it takes ownership of an object, and are never moved or freed
+ * before the table is, so other threads only ever see stable storage.
+ */
+class FGWIZConcurrentCheckoutFlags
+{
+public:
+    FGWIZConcurrentCheckoutFlags() = default;
+
+    ~FGWIZConcurrentCheckoutFlags()
+    {
+        for (int32 PageIndex = 0; PageIndex < DirectorySize; ++PageIndex)
+        {
+            delete Directory[PageIndex].load(std::memory_order_relaxed);
+        }
+    }
+
+    FGWIZConcurrentCheckoutFlags(const FGWIZConcurrentCheckoutFlags&) = delete;
+    FGWIZConcurrentCheckoutFlags& operator=(const FGWIZConcurrentCheckoutFlags&) = delete;
+
+    /**
+     * Size the page directory; must happen before the table is shared with other threads.
+     * @param MaxObjects Upper bound on UObject unique ids (GUObjectArray capacity)
+     */
+    void Initialize(int32 MaxObjects)
+    {
+        if (Directory.IsValid())
+        {
+            return;
+        }
+        DirectorySize = FMath::DivideAndRoundUp(MaxObjects, PageSize);
+        Directory = MakeUnique<std::atomic<FPage*>[]>(DirectorySize);
+    }
+
+    /** Start tracking an object as available, adding its page if needed */
+    void Track(int32 ObjectIndex)
+    {
+        const int32 PageIndex = ObjectIndex / PageSize;
+        if (ObjectIndex < 0 || PageIndex >= DirectorySize)
+        {
+            return;
+        }
+
+        FPage* Page = Directory[PageIndex].load(std::memory_order_relaxed);
+        if (Page == nullptr)
+        {
+            Page = new FPage();
+            Directory[PageIndex].store(Page, std::memory_order_release);
+        }
+        Page->Flags[ObjectIndex % PageSize].store(0, std::memory_order_relaxed);
+    }
+
+    /** Stop tracking an object that left the pool; a later return of it is rejected */
+    void Untrack(int32 ObjectIndex)
+    {
+        if (std::atomic<uint8>* Flag = FindFlag(ObjectIndex))
+        {
+            Flag->store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /** Mark an object checked out; false if it already was or is not tracked */
+    bool TryCheckOut(int32 ObjectIndex)
+    {
+        uint8 Expected = 0;
+        std::atomic<uint8>* Flag = FindFlag(ObjectIndex);
+        return Flag != nullptr && Flag->compare_exchange_strong(Expected, 1, std::memory_order_acq_rel);
+    }
+
+    /** Mark an object available again; false if it was not checked out (a double return) */
+    bool TryCheckIn(int32 ObjectIndex)
+    {
+        uint8 Expected = 1;
+        std::atomic<uint8>* Flag = FindFlag(ObjectIndex);
+        return Flag != nullptr && Flag->compare_exchange_strong(Expected, 0, std::memory_order_acq_rel);
+    }
+
+private:
+    static constexpr int32 PageSize = 4096;
+
+    struct FPage
+    {
+        std::atomic<uint8> Flags[PageSize] = {};
+    };
+
+    std::atomic<uint8>* FindFlag(int32 ObjectIndex) const
+    {
+        const int32 PageIndex = ObjectIndex / PageSize;
+        if (ObjectIndex < 0 || PageIndex >= DirectorySize)
+        {
+            return nullptr;
+        }
+        FPage* Page = Directory[PageIndex].load(std::memory_order_acquire);
+        return Page != nullptr ? &Page->Flags[ObjectIndex % PageSize] : nullptr;
+    }
+
+    /** Page pointers, one per PageSize unique ids; filled in lazily */
+    TUniquePtr<std::atomic<FPage*>[]> Directory;
+    int32 DirectorySize = 0;
+};
+
+/**
+ * Usage observed by a pool between two adaptive sizing evaluations.
+ */
+struct FGWIZUsageSample
+{
+    /** Time the sample was taken (FPlatformTime::Seconds) */
+    double Time = 0.0;
+
+    /** Highest number of objects checked out at once during the sample */
+    int32 PeakInUse = 0;
+
+    /** Checkouts that had to create an object during the sample */
+    int32 Misses = 0;
+};
+
+/**
+ * Outcome of an adaptive sizing evaluation that wants the pool resized.
+ */
+struct FGWIZResizeDecision
+{
+    /** Objects owned by the pool (idle + in use) when the decision was made */
+    int32 CurrentTotal = 0;
+
+    /** Objects the pool should own */
+    int32 TargetTotal = 0;
+
+    /** Objects checked out when the decision was made */
+    int32 InUse = 0;
+
+    /** Peak concurrent usage over the sliding window */
+    int32 WindowPeak = 0;
+
+    /** Misses over the sliding window */
+    int32 WindowMisses = 0;
+
+    /** How long the pool has been over-provisioned (shrink decisions only) */
+    double OverProvisionedSeconds = 0.0;
+
+    bool IsGrow() const { return TargetTotal > CurrentTotal; }
+};
+
+/**
+ * Sliding-window state kept by a pool for adaptive sizing.
+ */
+struct FGWIZAdaptiveSizingState
+{
+    /** Samples inside the window, oldest first */
+    TArray<FGWIZUsageSample> Samples;
+
+    /** Highest in-use count since the last sample */
+    int32 PeakInUseSinceSample = 0;
+
+    /** Pool miss counter at the last sample */
+    int32 MissesAtLastSample = 0;
+
+    /** When the pool first exceeded the shrink threshold, or a negative value if it is not over-provisioned */
+    double OverProvisionedSince = -1.0;
+
+    /** Total the last grow decision asked for, so an unfinished grow is not decided again */
+    int32 PendingGrowTarget = INDEX_NONE;
+};
+
+/**
+ * How a pooled class receives IGWIZPoolable lifecycle callbacks.
+ */
+enum class EGWIZPoolableDispatch : uint8
+{
+    /** Class does not implement IGWIZPoolable */
+    None,
+    /** C++ implementation; called through the interface vtable */
+    Native,
+    /** Blueprint implementation; called through ProcessEvent with a cached UFunction */
+    Blueprint
+};
+
+/**
+ * What a pool needs to toggle on a profiled actor component when the actor is checked out or returned.
+ */
+enum class EGWIZComponentToggle : uint8
+{
+    None       = 0,
+    /** Visible primitive; needs its render state refreshed when the actor is shown or hidden */
+    Visibility = 1 << 0,
+    /** Primitive with collision; switched between its original collision setting and NoCollision */
+    Collision  = 1 << 1,
+    /** Component that can tick; tick enabled and disabled directly */
+    Tick       = 1 << 2,
+    /** Particle or Niagara system; activated and deactivated immediately */
+    FX         = 1 << 3,
+    /** Audio component; played and stopped */
+    Audio      = 1 << 4,
+    /** Other auto-activating component (e.g. projectile movement); activated and deactivated */
+    Activation = 1 << 5,
+    /** Has scene or physics presence; unregistered while the actor is deep parked */
+    Register   = 1 << 6
+};
+ENUM_CLASS_FLAGS(EGWIZComponentToggle);
+
+/**
+ * One component of a pooled actor class that needs work when the actor changes state.
+ */
+struct FGWIZComponentProfileEntry
+{
+    FGWIZComponentProfileEntry()
+        : Toggles(EGWIZComponentToggle::None)
+        , CollisionEnabled(ECollisionEnabled::NoCollision)
+    {
+    }
+
+    /** Component name, used to find the matching component on each pooled instance */
+    FName ComponentName;
+
+    /** Operations this component needs */
+    EGWIZComponentToggle Toggles;
+
+    /** Collision setting to restore on checkout */
+    TEnumAsByte<ECollisionEnabled::Type> CollisionEnabled;
+};
+
+/**
+ * Lifecycle dispatch information resolved once per pooled class.
+ * Lets the checkout and return paths skip interface lookups, casts and function name searches.
+ */
+struct FGWIZClassLifecycle
+{
+    FGWIZClassLifecycle()
+        : Dispatch(EGWIZPoolableDispatch::None)
+        , NativeInterfaceOffset(0)
+        , OnPooledFunction(nullptr)
+        , OnUnpooledFunction(nullptr)
+        , bIsActor(false)
+        , bCanEverTick(false)
+        , bComponentProfileBuilt(false)
+    {
+    }
+
+    /** How OnPooled/OnUnpooled are invoked */
+    EGWIZPoolableDispatch Dispatch;
+
+    /** Byte offset from the object to its IGWIZPoolable subobject (Native dispatch only) */
+    int32 NativeInterfaceOffset;
+
+    /** Resolved OnPooled function (Blueprint dispatch only) */
+    UFunction* OnPooledFunction;
+
+    /** Resolved OnUnpooled function (Blueprint dispatch only) */
+    UFunction* OnUnpooledFunction;
+
+    /** Whether the class is an AActor subclass */
+    bool bIsActor;
+
+    /** Whether actors of this class can tick at all */
+    bool bCanEverTick;
+
+    /** Whether ComponentProfile has been built from a live instance (actors only) */
+    bool bComponentProfileBuilt;
+
+    /** Components that need toggling on checkout and return; components that need nothing are left out */
+    TArray<FGWIZComponentProfileEntry> ComponentProfile;
+};
+
 /**
  * Wrapper struct for level-specific pool configurations.
  * This is needed because UHT cannot handle nested TMap types.
@@ -211,3 +852,129 @@ public:
         return Names;
     }
 };
+
+/**
+ * Concurrent usage of one pool sampled at a fixed interval over a level.
+ * One bucket per in-use count, which stays small because in-use counts are bounded by the pool.
+ */
+struct FGWIZConcurrencyHistogram
+{
+    /** Number of samples per in-use count */
+    TArray<uint32> Counts;
+
+    /** Total number of samples */
+    uint32 SampleCount = 0;
+
+    /** Highest in-use count sampled */
+    int32 Peak = 0;
+
+    /** Record one sample */
+    void Add(int32 InUse)
+    {
+        InUse = FMath::Max(0, InUse);
+        if (InUse >= Counts.Num())
+        {
+            Counts.SetNumZeroed(InUse + 1);
+        }
+        ++Counts[InUse];
+        ++SampleCount;
+        Peak = FMath::Max(Peak, InUse);
+    }
+
+    /**
+     * In-use count at a percentile of the samples.
+     * @param Fraction Percentile as a fraction (0.95 for p95)
+     * @return Smallest in-use count covering that fraction of the samples
+     */
+    int32 GetPercentile(double Fraction) const
+    {
+        if (SampleCount == 0)
+        {
+            return 0;
+        }
+
+        const uint32 Rank = FMath::Max<uint32>(1, static_cast<uint32>(FMath::CeilToDouble(FMath::Clamp(Fraction, 0.0, 1.0) * SampleCount)));
+        uint32 Seen = 0;
+        for (int32 InUse = 0; InUse < Counts.Num(); ++InUse)
+        {
+            Seen += Counts[InUse];
+            if (Seen >= Rank)
+            {
+                return InUse;
+            }
+        }
+        return Peak;
+    }
+
+    /** Clear all samples */
+    void Reset()
+    {
+        *this = FGWIZConcurrencyHistogram();
+    }
+};
+
+/**
+ * Concurrent usage learned for one pool in one level, carried across sessions.
+ */
+USTRUCT(BlueprintType)
+struct PLANETDEFENDER_API FGWIZPoolUsageProfile
+{
+    GENERATED_BODY()
+
+public:
+    FGWIZPoolUsageProfile()
+        : PeakConcurrentUsage(0)
+        , P95ConcurrentUsage(0)
+        , SessionCount(0)
+    {
+    }
+
+    /** Highest number of objects in use at once; decays halfway toward lower observations so one-off spikes fade */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GWIZ Pooling")
+    int32 PeakConcurrentUsage;
+
+    /** Number of objects in use 95% of the time, averaged with previous sessions */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GWIZ Pooling")
+    int32 P95ConcurrentUsage;
+
+    /** Number of level visits folded into this profile */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GWIZ Pooling")
+    int32 SessionCount;
+
+    /**
+     * Fold one visit's observations into the profile.
+     * @param ObservedPeak Peak in-use count during the visit
+     * @param ObservedP95 p95 in-use count during the visit
+     */
+    void Merge(int32 ObservedPeak, int32 ObservedP95)
+    {
+        if (SessionCount == 0)
+        {
+            PeakConcurrentUsage = ObservedPeak;
+            P95ConcurrentUsage = ObservedP95;
+        }
+        else
+        {
+            PeakConcurrentUsage = FMath::Max(ObservedPeak, FMath::DivideAndRoundUp(PeakConcurrentUsage + ObservedPeak, 2));
+            P95ConcurrentUsage = FMath::DivideAndRoundUp(P95ConcurrentUsage + ObservedP95, 2);
+        }
+        ++SessionCount;
+    }
+};
+
+/**
+ * Wrapper struct for a level's learned usage profiles, keyed by pooled class name.
+ * This is needed because UHT cannot handle nested TMap types.
+ */
+USTRUCT(BlueprintType)
+struct PLANETDEFENDER_API FGWIZLevelUsageProfiles
+{
+    GENERATED_BODY()
+
+public:
+    FGWIZLevelUsageProfiles() = default;
+
+    /** Map of usage profiles for this level */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GWIZ Pooling")
+    TMap<FString, FGWIZPoolUsageProfile> Profiles;
+};
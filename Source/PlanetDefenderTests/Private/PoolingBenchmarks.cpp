@@ -0,0 +1,531 @@
+// Copyright (c) 2024 Groove Wizard, Inc. All Rights Reserved.
+// This code is part of the GWIZ Generic Pooling System for Unreal Engine.
+
+#include "PoolingBenchmarks.h"
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "UObject/UObjectGlobals.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "PoolingSystem/GWIZObjectPool.h"
+#include "PoolingSystem/GWIZPoolingManager.h"
+#include "PoolingSystem/GWIZTypedPool.h"
+#include "PoolingSystem/PoolingTypes.h"
+#include "TestRunner.h"
+
+/**
+ * Benchmark suite for GWIZ Pooling System.
+ * Each benchmark logs the average cost of a single operation in nanoseconds.
+ */
+class FPoolingBenchmarks
+{
+public:
+    static void RunAllBenchmarks()
+    {
+        UE_LOG(LogTemp, Log, TEXT("=== Starting Pooling Benchmarks ==="));
+        
+        BenchmarkReturnTracking();
+        BenchmarkBatchOperations();
+        BenchmarkLifecycleDispatch();
+        BenchmarkTypedPool();
+        BenchmarkComponentProfiles();
+        BenchmarkThreadContention();
+        BenchmarkRegistryLookup();
+        
+        UE_LOG(LogTemp, Log, TEXT("=== Pooling Benchmarks Complete ==="));
+    }
+
+private:
+    /** Convert a cycle delta into nanoseconds per operation */
+    static double CyclesToNanosecondsPerOp(uint64 Cycles, int32 Operations)
+    {
+        return Operations > 0 ? FPlatformTime::ToSeconds64(Cycles) * 1.0e9 / Operations : 0.0;
+    }
+
+    /** Create a pool of test objects with monitoring disabled so only tracking cost is measured */
+    static UGWIZObjectPool* CreateBenchmarkPool(int32 MaxPoolSize)
+    {
+        UGWIZObjectPool* Pool = NewObject<UGWIZObjectPool>();
+        Pool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        Pool->Config.MinPoolSize = 1;
+        Pool->Config.MaxPoolSize = MaxPoolSize;
+        Pool->Config.InitialPoolSize = MaxPoolSize;
+        Pool->Config.bEnableMonitoring = false;
+        Pool->InitializePool();
+        return Pool;
+    }
+
+    /**
+     * Compare returning objects with a linear in-use array (the previous implementation)
+     * against the pool's slot-based in-use set, with N objects live at once.
+     */
+    static void BenchmarkReturnTracking()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Benchmarking return tracking..."));
+        
+        const int32 LiveCounts[] = { 100, 1000, 10000 };
+        for (const int32 LiveCount : LiveCounts)
+        {
+            UGWIZObjectPool* Pool = CreateBenchmarkPool(LiveCount);
+            
+            TArray<UObject*> Objects;
+            Objects.Reserve(LiveCount);
+            for (int32 i = 0; i < LiveCount; ++i)
+            {
+                Objects.Add(Pool->GetFromPool());
+            }
+            
+            // Return in random order, as gameplay does
+            FRandomStream Random(LiveCount);
+            TArray<UObject*> ReturnOrder = Objects;
+            for (int32 i = ReturnOrder.Num() - 1; i > 0; --i)
+            {
+                ReturnOrder.Swap(i, Random.RandRange(0, i));
+            }
+            
+            // Previous implementation: TArray::Remove on the in-use list
+            TArray<UObject*> LegacyInUse = Objects;
+            const uint64 LegacyStart = FPlatformTime::Cycles64();
+            for (UObject* Object : ReturnOrder)
+            {
+                LegacyInUse.Remove(Object);
+            }
+            const uint64 LegacyCycles = FPlatformTime::Cycles64() - LegacyStart;
+            
+            // Current implementation: full ReturnObject through the slot set
+            const uint64 SlotStart = FPlatformTime::Cycles64();
+            for (UObject* Object : ReturnOrder)
+            {
+                Pool->ReturnObject(Object);
+            }
+            const uint64 SlotCycles = FPlatformTime::Cycles64() - SlotStart;
+            
+            UE_LOG(LogTemp, Log, TEXT("  %5d live objects: legacy remove %.1f ns/op, slot return %.1f ns/op, pool valid: %s"),
+                   LiveCount,
+                   CyclesToNanosecondsPerOp(LegacyCycles, LiveCount),
+                   CyclesToNanosecondsPerOp(SlotCycles, LiveCount),
+                   Pool->ValidatePool() ? TEXT("Yes") : TEXT("No"));
+            
+            Pool->ClearPool();
+        }
+    }
+
+    /**
+     * Compare acquiring and releasing objects one at a time against the batch API
+     * at increasing batch sizes. Monitoring stays enabled to include statistics cost.
+     */
+    static void BenchmarkBatchOperations()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Benchmarking batch acquire/release..."));
+        
+        const int32 TotalObjects = 4096;
+        const int32 BatchSizes[] = { 1, 8, 64, 512 };
+        
+        UGWIZObjectPool* Pool = CreateBenchmarkPool(TotalObjects);
+        Pool->Config.bEnableMonitoring = true;
+        
+        TArray<UObject*> Objects;
+        Objects.Reserve(TotalObjects);
+        
+        // Baseline: single-object calls
+        const uint64 SingleStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < TotalObjects; ++i)
+        {
+            Objects.Add(Pool->GetFromPool());
+        }
+        for (UObject* Object : Objects)
+        {
+            Pool->ReturnObject(Object);
+        }
+        const uint64 SingleCycles = FPlatformTime::Cycles64() - SingleStart;
+        UE_LOG(LogTemp, Log, TEXT("  single calls:     %.1f ns/object"), CyclesToNanosecondsPerOp(SingleCycles, TotalObjects));
+        
+        for (const int32 BatchSize : BatchSizes)
+        {
+            const int32 BatchCount = TotalObjects / BatchSize;
+            
+            const uint64 BatchStart = FPlatformTime::Cycles64();
+            for (int32 Batch = 0; Batch < BatchCount; ++Batch)
+            {
+                Objects.Reset();
+                Pool->GetObjects(UGWIZPoolingTestRunner::StaticClass(), BatchSize, Objects);
+                Pool->ReturnObjects(Objects);
+            }
+            const uint64 BatchCycles = FPlatformTime::Cycles64() - BatchStart;
+            
+            UE_LOG(LogTemp, Log, TEXT("  batch size %4d:  %.1f ns/object"),
+                   BatchSize, CyclesToNanosecondsPerOp(BatchCycles, BatchCount * BatchSize));
+        }
+        
+        Pool->ClearPool();
+    }
+
+    /**
+     * Compare the reflective lifecycle path (interface query, cast and Execute_ thunk on every call)
+     * against the pool's per-class cached dispatch.
+     */
+    static void BenchmarkLifecycleDispatch()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Benchmarking lifecycle dispatch..."));
+        
+        const int32 Iterations = 100000;
+        
+        UGWIZObjectPool* Pool = NewObject<UGWIZObjectPool>();
+        Pool->SetPooledObjectClass(UGWIZPoolableTestObject::StaticClass());
+        UGWIZPoolableTestObject* Object = NewObject<UGWIZPoolableTestObject>();
+        
+        // Baseline: the previous per-call lookup
+        const uint64 LegacyStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            if (Object->GetClass()->ImplementsInterface(UGWIZPoolable::StaticClass()))
+            {
+                IGWIZPoolable::Execute_OnPooled(Object);
+                IGWIZPoolable::Execute_OnUnpooled(Object);
+            }
+            if (AActor* Actor = Cast<AActor>(Object))
+            {
+                Actor->SetActorHiddenInGame(false);
+            }
+        }
+        const uint64 LegacyCycles = FPlatformTime::Cycles64() - LegacyStart;
+        
+        const uint64 CachedStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            Pool->DispatchOnPooled(Object);
+            Pool->DispatchOnUnpooled(Object);
+        }
+        const uint64 CachedCycles = FPlatformTime::Cycles64() - CachedStart;
+        
+        UE_LOG(LogTemp, Log, TEXT("  reflective: %.1f ns/transition pair, cached: %.1f ns/transition pair"),
+               CyclesToNanosecondsPerOp(LegacyCycles, Iterations), CyclesToNanosecondsPerOp(CachedCycles, Iterations));
+        
+        if (Object->PooledCount != Iterations * 2 || Object->UnpooledCount != Iterations * 2)
+        {
+            UE_LOG(LogTemp, Error, TEXT("  dispatch count mismatch: pooled=%d unpooled=%d"), Object->PooledCount, Object->UnpooledCount);
+        }
+    }
+
+    /**
+     * Compare a checkout/return round trip through the untyped API (Cast, cached interface dispatch)
+     * against TGWIZTypedPool with compile-time bound native hooks.
+     */
+    static void BenchmarkTypedPool()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Benchmarking typed pool..."));
+        
+        const int32 Iterations = 100000;
+        
+        UGWIZObjectPool* Pool = NewObject<UGWIZObjectPool>();
+        Pool->SetPooledObjectClass(UGWIZNativeHookTestObject::StaticClass());
+        Pool->Config.bEnableMonitoring = false;
+        TGWIZTypedPool<UGWIZNativeHookTestObject> TypedPool(Pool);
+        
+        const uint64 UntypedStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            UGWIZNativeHookTestObject* Object = Cast<UGWIZNativeHookTestObject>(Pool->GetObject(UGWIZNativeHookTestObject::StaticClass()));
+            Pool->ReturnObject(Object);
+        }
+        const uint64 UntypedCycles = FPlatformTime::Cycles64() - UntypedStart;
+        
+        const uint64 TypedStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            UGWIZNativeHookTestObject* Object = TypedPool.Acquire();
+            TypedPool.Release(Object);
+        }
+        const uint64 TypedCycles = FPlatformTime::Cycles64() - TypedStart;
+        
+        UE_LOG(LogTemp, Log, TEXT("  untyped + Cast: %.1f ns/round trip, typed: %.1f ns/round trip"),
+               CyclesToNanosecondsPerOp(UntypedCycles, Iterations), CyclesToNanosecondsPerOp(TypedCycles, Iterations));
+        
+        Pool->ClearPool();
+    }
+
+    /**
+     * Compare actor-wide hide/collision/tick toggles against the pool's cached component profile
+     * on an actor with many components, only a few of which collide.
+     */
+    static void BenchmarkComponentProfiles()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Benchmarking component profiles..."));
+        
+        const int32 ComponentCount = 32;
+        const int32 CollidingComponents = 4;
+        const int32 Iterations = 1000;
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("  failed to create test world"));
+            return;
+        }
+        TestWorld->InitWorld();
+        
+        AActor* Actor = TestWorld->SpawnActor<AActor>();
+        for (int32 i = 0; i < ComponentCount; ++i)
+        {
+            UBoxComponent* Box = NewObject<UBoxComponent>(Actor);
+            Box->SetCollisionEnabled(i < CollidingComponents ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
+            Box->SetHiddenInGame(i >= CollidingComponents);
+            Box->RegisterComponent();
+        }
+        
+        // Baseline: actor-wide calls walk every component
+        const uint64 LegacyStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            Actor->SetActorTickEnabled(false);
+            Actor->SetActorHiddenInGame(true);
+            Actor->SetActorEnableCollision(false);
+            Actor->SetActorTickEnabled(true);
+            Actor->SetActorHiddenInGame(false);
+            Actor->SetActorEnableCollision(true);
+        }
+        const uint64 LegacyCycles = FPlatformTime::Cycles64() - LegacyStart;
+        
+        UGWIZObjectPool* Pool = NewObject<UGWIZObjectPool>(TestWorld);
+        Pool->SetPooledObjectClass(AActor::StaticClass());
+        Pool->Config.MinPoolSize = 1;
+        Pool->Config.MaxPoolSize = 1;
+        Pool->Config.bEnableMonitoring = false;
+        Pool->Config.ActivationSteps = static_cast<int32>(EGWIZPoolActivationStep::Tick | EGWIZPoolActivationStep::Visibility | EGWIZPoolActivationStep::Collision);
+        Pool->AddToPool(Actor);
+        
+        const uint64 ProfiledStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            UObject* Object = Pool->GetObject(AActor::StaticClass());
+            Pool->ReturnObject(Object);
+        }
+        const uint64 ProfiledCycles = FPlatformTime::Cycles64() - ProfiledStart;
+        
+        // Deep parking trades per-cycle register/unregister cost for zero idle cost
+        Pool->Config.bDeepParkActors = true;
+        const uint64 DeepParkStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            UObject* Object = Pool->GetObject(AActor::StaticClass());
+            Pool->ReturnObject(Object);
+        }
+        const uint64 DeepParkCycles = FPlatformTime::Cycles64() - DeepParkStart;
+        
+        UE_LOG(LogTemp, Log, TEXT("  %d components (%d colliding): actor-wide %.1f ns/cycle, profiled %.1f ns/cycle, deep parked %.1f ns/cycle"),
+               ComponentCount, CollidingComponents,
+               CyclesToNanosecondsPerOp(LegacyCycles, Iterations), CyclesToNanosecondsPerOp(ProfiledCycles, Iterations),
+               CyclesToNanosecondsPerOp(DeepParkCycles, Iterations));
+        
+        Pool->ClearPool();
+        TestWorld->DestroyWorld(false);
+    }
+
+    /**
+     * Acquire/release throughput with several threads hammering one pool:
+     * a single-threaded pool behind a critical section versus the thread-safe lock-free pool.
+     */
+    static void BenchmarkThreadContention()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Benchmarking thread contention..."));
+        
+        const int32 OperationsPerThread = 20000;
+        const int32 ThreadCounts[] = { 1, 2, 4, 8 };
+        
+        UGWIZObjectPool* LockedPool = CreateBenchmarkPool(64);
+        FCriticalSection LockedPoolMutex;
+        
+        UGWIZObjectPool* ThreadSafePool = NewObject<UGWIZObjectPool>();
+        ThreadSafePool->Config.bEnableThreadSafety = true;
+        ThreadSafePool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        ThreadSafePool->Config.MinPoolSize = 1;
+        ThreadSafePool->Config.MaxPoolSize = 64;
+        ThreadSafePool->Config.InitialPoolSize = 64;
+        ThreadSafePool->Config.bEnableMonitoring = false;
+        ThreadSafePool->InitializePool();
+        
+        UGWIZObjectPool* CachedPool = NewObject<UGWIZObjectPool>();
+        CachedPool->Config.bEnableThreadSafety = true;
+        CachedPool->Config.ThreadCacheMagazineSize = 16;
+        CachedPool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        CachedPool->Config.MinPoolSize = 1;
+        CachedPool->Config.MaxPoolSize = 512;
+        CachedPool->Config.InitialPoolSize = 512;
+        CachedPool->Config.bEnableMonitoring = false;
+        CachedPool->InitializePool();
+        
+        if (!ThreadSafePool->IsThreadSafe() || !CachedPool->IsThreadSafe())
+        {
+            UE_LOG(LogTemp, Error, TEXT("  thread-safe mode was not enabled"));
+            return;
+        }
+        
+        for (const int32 ThreadCount : ThreadCounts)
+        {
+            const uint64 LockedStart = FPlatformTime::Cycles64();
+            ParallelFor(ThreadCount, [&](int32)
+            {
+                for (int32 i = 0; i < OperationsPerThread; ++i)
+                {
+                    FScopeLock Lock(&LockedPoolMutex);
+                    LockedPool->ReturnObject(LockedPool->GetFromPool());
+                }
+            });
+            const uint64 LockedCycles = FPlatformTime::Cycles64() - LockedStart;
+            
+            std::atomic<int32> Failures(0);
+            const uint64 LockFreeStart = FPlatformTime::Cycles64();
+            ParallelFor(ThreadCount, [&](int32)
+            {
+                for (int32 i = 0; i < OperationsPerThread; ++i)
+                {
+                    UObject* Object = ThreadSafePool->GetFromPool();
+                    if (Object)
+                    {
+                        ThreadSafePool->ReturnObject(Object);
+                    }
+                    else
+                    {
+                        Failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+            const uint64 LockFreeCycles = FPlatformTime::Cycles64() - LockFreeStart;
+            
+            // Each worker acquires a small burst before releasing, like a simulation step would
+            const uint64 CachedStart = FPlatformTime::Cycles64();
+            ParallelFor(ThreadCount, [&](int32)
+            {
+                UObject* Burst[8];
+                for (int32 i = 0; i < OperationsPerThread; i += UE_ARRAY_COUNT(Burst))
+                {
+                    for (UObject*& Object : Burst)
+                    {
+                        Object = CachedPool->GetFromPool();
+                    }
+                    for (UObject* Object : Burst)
+                    {
+                        if (Object)
+                        {
+                            CachedPool->ReturnObject(Object);
+                        }
+                        else
+                        {
+                            Failures.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            });
+            const uint64 CachedCycles = FPlatformTime::Cycles64() - CachedStart;
+            
+            const int32 TotalOperations = ThreadCount * OperationsPerThread;
+            UE_LOG(LogTemp, Log, TEXT("  %d threads: locked %.1f ns/op, lock-free %.1f ns/op, thread cache %.1f ns/op (%d empty-pool misses)"),
+                   ThreadCount, CyclesToNanosecondsPerOp(LockedCycles, TotalOperations),
+                   CyclesToNanosecondsPerOp(LockFreeCycles, TotalOperations),
+                   CyclesToNanosecondsPerOp(CachedCycles, TotalOperations), Failures.load());
+        }
+        
+        const FGWIZPoolStatistics CachedStats = CachedPool->GetStatistics();
+        UE_LOG(LogTemp, Log, TEXT("  thread cache: %d local acquires/releases, %d total acquire hits"), CachedStats.LocalCacheHits, CachedStats.PoolHits);
+        UE_LOG(LogTemp, Log, TEXT("  thread-safe pools valid: %s"),
+               (ThreadSafePool->ValidatePool() && CachedPool->ValidatePool()) ? TEXT("Yes") : TEXT("No"));
+        
+        LockedPool->ClearPool();
+        ThreadSafePool->ClearPool();
+        CachedPool->ClearPool();
+    }
+
+    /**
+     * Pool lookup throughput with 1, 4 and 16 reader threads: a class map behind a critical section
+     * (the previous registry) versus the manager's registry behind a shared read lock.
+     */
+    static void BenchmarkRegistryLookup()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Benchmarking registry lookup..."));
+        
+        const int32 LookupsPerThread = 200000;
+        const int32 ThreadCounts[] = { 1, 4, 16 };
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("  failed to create test world"));
+            return;
+        }
+        
+        TestWorld->InitWorld();
+        
+        AGWIZPoolingManager* Manager = TestWorld->SpawnActor<AGWIZPoolingManager>();
+        if (!Manager)
+        {
+            UE_LOG(LogTemp, Error, TEXT("  failed to spawn pooling manager"));
+            TestWorld->DestroyWorld(false);
+            return;
+        }
+        
+        // Exact matches, a subclass resolved through its parent's pool, and a class with no pool
+        Manager->GetPool(UGWIZPoolingTestRunner::StaticClass());
+        Manager->GetPool(UShapeComponent::StaticClass());
+        Manager->GetPool(AActor::StaticClass());
+        UClass* const LookupClasses[] = { UGWIZPoolingTestRunner::StaticClass(), UShapeComponent::StaticClass(),
+                                          AActor::StaticClass(), UBoxComponent::StaticClass(), UGWIZObjectPool::StaticClass() };
+        
+        // Baseline: the same resolutions in a map that every reader locks
+        TMap<UClass*, UGWIZObjectPool*> LockedRegistry;
+        for (UClass* LookupClass : LookupClasses)
+        {
+            LockedRegistry.Add(LookupClass, Manager->GetPoolForClass(LookupClass));
+        }
+        FCriticalSection LockedRegistryMutex;
+        
+        for (const int32 ThreadCount : ThreadCounts)
+        {
+            std::atomic<int32> Found(0);
+            
+            const uint64 LockedStart = FPlatformTime::Cycles64();
+            ParallelFor(ThreadCount, [&](int32)
+            {
+                int32 LocalFound = 0;
+                for (int32 i = 0; i < LookupsPerThread; ++i)
+                {
+                    FScopeLock Lock(&LockedRegistryMutex);
+                    LocalFound += LockedRegistry.FindRef(LookupClasses[i % UE_ARRAY_COUNT(LookupClasses)]) != nullptr;
+                }
+                Found.fetch_add(LocalFound, std::memory_order_relaxed);
+            });
+            const uint64 LockedCycles = FPlatformTime::Cycles64() - LockedStart;
+            
+            const uint64 SharedStart = FPlatformTime::Cycles64();
+            ParallelFor(ThreadCount, [&](int32)
+            {
+                int32 LocalFound = 0;
+                for (int32 i = 0; i < LookupsPerThread; ++i)
+                {
+                    LocalFound += Manager->GetPoolForClass(LookupClasses[i % UE_ARRAY_COUNT(LookupClasses)]) != nullptr;
+                }
+                Found.fetch_add(LocalFound, std::memory_order_relaxed);
+            });
+            const uint64 SharedCycles = FPlatformTime::Cycles64() - SharedStart;
+            
+            const int32 TotalLookups = ThreadCount * LookupsPerThread;
+            UE_LOG(LogTemp, Log, TEXT("  %d readers: locked %.1f ns/lookup (%.1f M/s), shared lock %.1f ns/lookup (%.1f M/s), %d hits"),
+                   ThreadCount,
+                   CyclesToNanosecondsPerOp(LockedCycles, TotalLookups), TotalLookups / FPlatformTime::ToSeconds64(LockedCycles) / 1.0e6,
+                   CyclesToNanosecondsPerOp(SharedCycles, TotalLookups), TotalLookups / FPlatformTime::ToSeconds64(SharedCycles) / 1.0e6,
+                   Found.load());
+        }
+        
+        Manager->ClearAllPools();
+        TestWorld->DestroyWorld(false);
+    }
+};
+
+// Benchmark runner that can be called from anywhere
+void RunPoolingBenchmarks()
+{
+    FPoolingBenchmarks::RunAllBenchmarks();
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2024 Groove Wizard, Inc. All Rights Reserved.
+// This code is part of the GWIZ Generic Pooling System for Unreal Engine.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Micro-benchmarks for GWIZ Pooling System hot paths.
+ * Results are written to the log as per-operation timings.
+ */
+
+/** Run all pooling benchmarks */
+void RunPoolingBenchmarks();
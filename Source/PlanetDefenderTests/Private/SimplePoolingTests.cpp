@@ -4,9 +4,14 @@
 #include "SimplePoolingTests.h"
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "UObject/UObjectGlobals.h"
 #include "PoolingSystem/GWIZObjectPool.h"
 #include "PoolingSystem/GWIZPoolingManager.h"
+#include "PoolingSystem/GWIZStructPool.h"
+#include "PoolingSystem/GWIZTypedPool.h"
 #include "PoolingSystem/PoolingTypes.h"
 #include "TestRunner.h"
 
@@ -25,7 +30,22 @@ public:
         TestObjectRetrievalAndReturn();
         TestPoolConfiguration();
         TestPoolStatistics();
+        TestHandlesAndDoubleReturn();
         TestPoolingManager();
+        TestActivationPipeline();
+        TestStructPool();
+        TestTypedPool();
+        TestAdaptiveSizing();
+        TestBudgetedDestruction();
+        TestLifetimeHistogram();
+        TestMemoryAccounting();
+        TestMemoryBudgets();
+        TestUsageProfiles();
+        TestPoolResolution();
+        TestPerWorldManagers();
+        TestPoolIndex();
+        TestMaintenanceScheduler();
+        TestPoolRegistry();
         
         UE_LOG(LogTemp, Log, TEXT("=== Simple Pooling Tests Complete ==="));
     }
@@ -127,7 +147,7 @@ private:
         UE_LOG(LogTemp, Log, TEXT("Max pool size: %d"), TestPool->Config.MaxPoolSize);
         UE_LOG(LogTemp, Log, TEXT("Initial pool size: %d"), TestPool->Config.InitialPoolSize);
         UE_LOG(LogTemp, Log, TEXT("Priority: %d"), TestPool->Config.Priority);
-        UE_LOG(LogTemp, Log, TEXT("Category: %s"), *TestPool->Config.Category);
+        UE_LOG(LogTemp, Log, TEXT("Category: %s"), *TestPool->Config.Category.ToString());
         
         TestPool->ClearPool();
     }
@@ -178,6 +198,63 @@ private:
         TestPool->ClearPool();
     }
     
+    static void TestHandlesAndDoubleReturn()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Handles and Double Return..."));
+        
+        UGWIZObjectPool* TestPool = NewObject<UGWIZObjectPool>();
+        TestPool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        TestPool->Config.MinPoolSize = 1;
+        TestPool->Config.MaxPoolSize = 10;
+        TestPool->Config.InitialPoolSize = 2;
+        TestPool->InitializePool();
+        
+        // Check out with a handle
+        FGWIZPoolHandle Handle;
+        UObject* Obj = TestPool->GetObjectWithHandle(UGWIZPoolingTestRunner::StaticClass(), Handle);
+        const bool bHandleResolves = TestPool->ResolveHandle(Handle) == Obj;
+        UE_LOG(LogTemp, Log, TEXT("Handle resolves to object: %s"), bHandleResolves ? TEXT("Yes") : TEXT("No"));
+        
+        // Return by handle, then try again with the same (now stale) handle
+        const bool bFirstReturn = TestPool->ReturnObjectByHandle(Handle);
+        const bool bStaleReturn = TestPool->ReturnObjectByHandle(Handle);
+        UE_LOG(LogTemp, Log, TEXT("First return accepted: %s"), bFirstReturn ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("Stale handle rejected: %s"), !bStaleReturn ? TEXT("Yes") : TEXT("No"));
+        
+        // Double return through the raw pointer must not duplicate the object
+        TestPool->ReturnToPool(Obj);
+        UObject* First = TestPool->GetFromPool();
+        UObject* Second = TestPool->GetFromPool();
+        UE_LOG(LogTemp, Log, TEXT("Double return ignored: %s"), First != Second ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("Pool valid: %s"), TestPool->ValidatePool() ? TEXT("Yes") : TEXT("No"));
+        
+        TestPool->ReturnToPool(First);
+        TestPool->ReturnToPool(Second);
+        TestPool->ClearPool();
+        
+        // The lock-free path rejects a double return too, so two callers never get the same object
+        UGWIZObjectPool* ThreadSafePool = NewObject<UGWIZObjectPool>();
+        ThreadSafePool->Config.bEnableThreadSafety = true;
+        ThreadSafePool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        ThreadSafePool->Config.MinPoolSize = 1;
+        ThreadSafePool->Config.MaxPoolSize = 10;
+        ThreadSafePool->Config.InitialPoolSize = 2;
+        ThreadSafePool->InitializePool();
+        
+        UObject* Concurrent = ThreadSafePool->GetFromPool();
+        const bool bConcurrentFirst = ThreadSafePool->ReturnObjectWithHook(Concurrent, nullptr);
+        const bool bConcurrentDouble = ThreadSafePool->ReturnObjectWithHook(Concurrent, nullptr);
+        UE_LOG(LogTemp, Log, TEXT("Thread-safe double return rejected: %s"), (bConcurrentFirst && !bConcurrentDouble) ? TEXT("Yes") : TEXT("No"));
+        
+        UObject* ConcurrentFirst = ThreadSafePool->GetFromPool();
+        UObject* ConcurrentSecond = ThreadSafePool->GetFromPool();
+        UE_LOG(LogTemp, Log, TEXT("Thread-safe checkouts distinct: %s"), ConcurrentFirst != ConcurrentSecond ? TEXT("Yes") : TEXT("No"));
+        
+        ThreadSafePool->ReturnObject(ConcurrentFirst);
+        ThreadSafePool->ReturnObject(ConcurrentSecond);
+        ThreadSafePool->ClearPool();
+    }
+    
     static void TestPoolingManager()
     {
         UE_LOG(LogTemp, Log, TEXT("Testing Pooling Manager..."));
@@ -232,6 +309,685 @@ private:
         Manager->Destroy();
         TestWorld->DestroyWorld(false);
     }
+    
+    static void TestActivationPipeline()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Activation Pipeline..."));
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create test world"));
+            return;
+        }
+        
+        TestWorld->InitWorld();
+        
+        AGWIZPoolingManager* Manager = TestWorld->SpawnActor<AGWIZPoolingManager>();
+        if (!Manager)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to spawn pooling manager"));
+            TestWorld->DestroyWorld(false);
+            return;
+        }
+        
+        // Callbacks must run exactly once per transition when going through the manager
+        UGWIZPoolableTestObject* Object = Cast<UGWIZPoolableTestObject>(Manager->GetPooledObject(UGWIZPoolableTestObject::StaticClass()));
+        if (Object)
+        {
+            Manager->ReturnPooledObject(Object);
+            UE_LOG(LogTemp, Log, TEXT("OnPooled called once: %s"), Object->PooledCount == 1 ? TEXT("Yes") : TEXT("No"));
+            UE_LOG(LogTemp, Log, TEXT("OnUnpooled called once: %s"), Object->UnpooledCount == 1 ? TEXT("Yes") : TEXT("No"));
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to retrieve poolable test object"));
+        }
+        
+        // Masking out the interface step skips the callbacks entirely
+        UGWIZObjectPool* Pool = Manager->GetPool(UGWIZPoolableTestObject::StaticClass());
+        if (Pool && Object)
+        {
+            Pool->Config.ActivationSteps &= ~static_cast<int32>(EGWIZPoolActivationStep::InterfaceCallbacks);
+            UObject* Reused = Manager->GetPooledObject(UGWIZPoolableTestObject::StaticClass());
+            Manager->ReturnPooledObject(Reused);
+            UE_LOG(LogTemp, Log, TEXT("Masked callbacks skipped: %s"),
+                   (Object->PooledCount == 1 && Object->UnpooledCount == 1) ? TEXT("Yes") : TEXT("No"));
+        }
+        
+        Manager->Destroy();
+        TestWorld->DestroyWorld(false);
+    }
+    
+    static void TestStructPool()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Struct Pool..."));
+        
+        struct FTestProjectileData
+        {
+            FVector Position;
+            FVector Velocity;
+            float Damage;
+            
+            FTestProjectileData(const FVector& InPosition, const FVector& InVelocity, float InDamage)
+                : Position(InPosition), Velocity(InVelocity), Damage(InDamage)
+            {
+            }
+        };
+        
+        TGWIZStructPool<FTestProjectileData, 8> TestPool(TEXT("TestProjectiles"));
+        
+        // Elements are constructed in place and resolved through handles
+        const FGWIZPoolHandle Handle = TestPool.Acquire(FVector::ZeroVector, FVector(100.0f, 0.0f, 0.0f), 25.0f);
+        const FTestProjectileData* Data = TestPool.Get(Handle);
+        UE_LOG(LogTemp, Log, TEXT("Element constructed: %s"), (Data && Data->Damage == 25.0f) ? TEXT("Yes") : TEXT("No"));
+        
+        // Released handles go stale, even once the slot is reused
+        TestPool.Release(Handle);
+        const FGWIZPoolHandle Reused = TestPool.Acquire(FVector::OneVector, FVector::ZeroVector, 5.0f);
+        UE_LOG(LogTemp, Log, TEXT("Slot reused: %s"), Reused.SlotIndex == Handle.SlotIndex ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("Stale handle rejected: %s"), TestPool.Get(Handle) == nullptr ? TEXT("Yes") : TEXT("No"));
+        
+        // Filling past one chunk adds another without moving existing elements
+        const FTestProjectileData* ReusedData = TestPool.Get(Reused);
+        TArray<FGWIZPoolHandle> Handles;
+        for (int32 i = 0; i < 20; ++i)
+        {
+            Handles.Add(TestPool.Acquire(FVector::ZeroVector, FVector::ZeroVector, static_cast<float>(i)));
+        }
+        UE_LOG(LogTemp, Log, TEXT("Elements stable across growth: %s"), TestPool.Get(Reused) == ReusedData ? TEXT("Yes") : TEXT("No"));
+        
+        int32 LiveCount = 0;
+        TestPool.ForEachLive([&LiveCount](FTestProjectileData&) { ++LiveCount; });
+        UE_LOG(LogTemp, Log, TEXT("Live elements: %d (expected %d), capacity %d"), LiveCount, TestPool.Num(), TestPool.Capacity());
+        
+        // Trimming frees empty trailing chunks; handles into them stay stale after regrowth
+        for (const FGWIZPoolHandle& Each : Handles)
+        {
+            TestPool.Release(Each);
+        }
+        TestPool.TrimUnusedChunks();
+        UE_LOG(LogTemp, Log, TEXT("Trimmed capacity: %d"), TestPool.Capacity());
+        TestPool.Reserve(24);
+        UE_LOG(LogTemp, Log, TEXT("Trimmed handle stays stale: %s"), TestPool.Get(Handles.Last()) == nullptr ? TEXT("Yes") : TEXT("No"));
+        
+        const FGWIZPoolStatistics Stats = TestPool.GetStatistics();
+        UE_LOG(LogTemp, Log, TEXT("Struct pool hits: %d, misses: %d, memory: %lld bytes"), Stats.PoolHits, Stats.PoolMisses, Stats.MemoryUsage);
+        
+        TestPool.Reset();
+    }
+    
+    static void TestTypedPool()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Typed Pool..."));
+        
+        static_assert(TGWIZTypedPool<UGWIZNativeHookTestObject>::HasNativeHooks(), "Native hooks should be detected");
+        static_assert(!TGWIZTypedPool<UGWIZPoolableTestObject>::HasNativeHooks(), "Interface-only class has no native hooks");
+        
+        UGWIZObjectPool* Pool = NewObject<UGWIZObjectPool>();
+        TGWIZTypedPool<UGWIZNativeHookTestObject> TypedPool(Pool);
+        
+        // Native hooks run in place of the interface callbacks
+        FGWIZPoolHandle Handle;
+        UGWIZNativeHookTestObject* Object = TypedPool.Acquire(Handle);
+        if (!Object)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to acquire from typed pool"));
+            return;
+        }
+        UE_LOG(LogTemp, Log, TEXT("Typed handle resolves: %s"), TypedPool.Resolve(Handle) == Object ? TEXT("Yes") : TEXT("No"));
+        TypedPool.Release(Handle);
+        UE_LOG(LogTemp, Log, TEXT("Native hooks called once: %s"),
+               (Object->NativePooledCount == 1 && Object->NativeUnpooledCount == 1) ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("Interface callbacks skipped: %s"),
+               (Object->PooledCount == 0 && Object->UnpooledCount == 0) ? TEXT("Yes") : TEXT("No"));
+        
+        // The untyped API still dispatches through the interface
+        UObject* Untyped = Pool->GetObject(UGWIZNativeHookTestObject::StaticClass());
+        Pool->ReturnObject(Untyped);
+        UE_LOG(LogTemp, Log, TEXT("Untyped path uses interface: %s"),
+               (Object->PooledCount == 1 && Object->NativePooledCount == 1) ? TEXT("Yes") : TEXT("No"));
+        
+        // Stale handles and double returns are rejected without running hooks again
+        const bool bStaleRejected = !TypedPool.Release(Handle);
+        const bool bDoubleRejected = !TypedPool.Release(Object);
+        UE_LOG(LogTemp, Log, TEXT("Stale release rejected: %s"), (bStaleRejected && bDoubleRejected) ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("No extra hook calls: %s"), Object->NativeUnpooledCount == 1 ? TEXT("Yes") : TEXT("No"));
+        
+        Pool->ClearPool();
+        
+        // Thread-safe pools issue no handles, so only the pointer overload returns objects
+        UGWIZObjectPool* ThreadSafePool = NewObject<UGWIZObjectPool>();
+        ThreadSafePool->Config.bEnableThreadSafety = true;
+        TGWIZTypedPool<UGWIZNativeHookTestObject> ThreadSafeTypedPool(ThreadSafePool);
+        ThreadSafePool->InitializePool();
+        
+        FGWIZPoolHandle UnissuedHandle;
+        UGWIZNativeHookTestObject* Concurrent = ThreadSafeTypedPool.Acquire(UnissuedHandle);
+        const bool bHandleRejected = !ThreadSafeTypedPool.Release(UnissuedHandle);
+        const bool bPointerAccepted = Concurrent && ThreadSafeTypedPool.Release(Concurrent);
+        UE_LOG(LogTemp, Log, TEXT("Thread-safe handle unset: %s, handle release rejected: %s, pointer release accepted: %s"),
+               !UnissuedHandle.IsSet() ? TEXT("Yes") : TEXT("No"), bHandleRejected ? TEXT("Yes") : TEXT("No"), bPointerAccepted ? TEXT("Yes") : TEXT("No"));
+        
+        ThreadSafePool->ClearPool();
+    }
+    
+    static void TestAdaptiveSizing()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Adaptive Sizing..."));
+        
+        UGWIZObjectPool* TestPool = NewObject<UGWIZObjectPool>();
+        TestPool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        TestPool->Config.MinPoolSize = 2;
+        TestPool->Config.MaxPoolSize = 50;
+        TestPool->Config.InitialPoolSize = 2;
+        TestPool->Config.AdaptiveWindowSeconds = 1.0f;
+        TestPool->Config.AdaptiveHeadroom = 0.25f;
+        TestPool->Config.AdaptiveShrinkDelaySeconds = 2.0f;
+        TestPool->InitializePool();
+        
+        // A wave of 20 checkouts asks for peak plus headroom
+        TArray<UObject*> Objects;
+        TestPool->GetObjects(UGWIZPoolingTestRunner::StaticClass(), 20, Objects);
+        FGWIZResizeDecision Decision;
+        
+        // A grow refused over budget is not remembered, so it is decided once growing is allowed again
+        const bool bRefused = TestPool->EvaluateAdaptiveSize(0.0, Decision, false);
+        UE_LOG(LogTemp, Log, TEXT("Refused grow not decided: %s"), !bRefused ? TEXT("Yes") : TEXT("No"));
+        
+        const bool bGrow = TestPool->EvaluateAdaptiveSize(0.0, Decision);
+        UE_LOG(LogTemp, Log, TEXT("Grow decided: %s (target %d, expected 25)"), (bGrow && Decision.IsGrow()) ? TEXT("Yes") : TEXT("No"), Decision.TargetTotal);
+        
+        // The same unfinished grow is not decided twice
+        const bool bRepeat = TestPool->EvaluateAdaptiveSize(0.5, Decision);
+        UE_LOG(LogTemp, Log, TEXT("Pending grow not repeated: %s"), !bRepeat ? TEXT("Yes") : TEXT("No"));
+        
+        // After the wave, the peak has to leave the window and the pool has to stay idle for the full delay
+        TestPool->ReturnObjects(Objects);
+        bool bEarlyShrink = false;
+        for (double Now = 2.0; Now <= 5.0; Now += 1.0)
+        {
+            bEarlyShrink |= TestPool->EvaluateAdaptiveSize(Now, Decision);
+        }
+        UE_LOG(LogTemp, Log, TEXT("No shrink before delay: %s"), !bEarlyShrink ? TEXT("Yes") : TEXT("No"));
+        
+        const bool bShrink = TestPool->EvaluateAdaptiveSize(6.0, Decision);
+        UE_LOG(LogTemp, Log, TEXT("Shrink decided: %s (target %d, expected %d)"),
+               (bShrink && !Decision.IsGrow()) ? TEXT("Yes") : TEXT("No"), Decision.TargetTotal, TestPool->Config.MinPoolSize);
+        if (bShrink)
+        {
+            TestPool->TrimIdleObjects(Decision.TargetTotal - Decision.InUse);
+        }
+        UE_LOG(LogTemp, Log, TEXT("Pool size after shrink: %d"), TestPool->GetCurrentPoolSize());
+        UE_LOG(LogTemp, Log, TEXT("Peak concurrent usage tracks in-use objects: %s"),
+               TestPool->GetStatistics().PeakConcurrentUsage == 20 ? TEXT("Yes") : TEXT("No"));
+        
+        TestPool->ClearPool();
+    }
+    
+    static void TestBudgetedDestruction()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Budgeted Destruction..."));
+        
+        UGWIZObjectPool* TestPool = NewObject<UGWIZObjectPool>();
+        TestPool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        TestPool->Config.MinPoolSize = 1;
+        TestPool->Config.MaxPoolSize = 2;
+        TestPool->Config.InitialPoolSize = 0;
+        TestPool->InitializePool();
+        
+        // The owner is told once when the queue becomes non-empty, not per object
+        int32 QueueNotifications = 0;
+        TestPool->OnDestroyQueued.BindLambda([&QueueNotifications](UGWIZObjectPool*) { ++QueueNotifications; });
+        
+        // Returns beyond MaxPoolSize are queued for destruction instead of dropped
+        TArray<UObject*> Objects;
+        TestPool->GetObjects(UGWIZPoolingTestRunner::StaticClass(), 4, Objects);
+        TestPool->ReturnObjects(Objects);
+        UE_LOG(LogTemp, Log, TEXT("Surplus queued: %d (expected 2), queue notifications: %d (expected 1)"),
+               TestPool->GetPendingDestroyCount(), QueueNotifications);
+        
+        // An expired deadline still destroys one object per call
+        const int32 Destroyed = TestPool->ProcessPendingDestroy(0.0);
+        UE_LOG(LogTemp, Log, TEXT("Destroyed within budget: %d (expected 1), pending: %d"), Destroyed, TestPool->GetPendingDestroyCount());
+        
+        int32 GarbageCount = 0;
+        for (UObject* Object : Objects)
+        {
+            GarbageCount += IsValid(Object) ? 0 : 1;
+        }
+        UE_LOG(LogTemp, Log, TEXT("Objects marked as garbage: %d (expected 1)"), GarbageCount);
+        
+        // Shrinking queues idle objects; clearing destroys everything that is left
+        TestPool->ShrinkToMinimum();
+        UE_LOG(LogTemp, Log, TEXT("Pending after shrink: %d (expected 2)"), TestPool->GetPendingDestroyCount());
+        TestPool->ClearPool();
+        UE_LOG(LogTemp, Log, TEXT("Pending after clear: %d"), TestPool->GetPendingDestroyCount());
+        TestPool->OnDestroyQueued.Unbind();
+        
+        // Thread-safe pools hand surplus returns to the game thread instead of keeping every object they created
+        UGWIZObjectPool* ThreadSafePool = NewObject<UGWIZObjectPool>();
+        ThreadSafePool->Config.bEnableThreadSafety = true;
+        ThreadSafePool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        ThreadSafePool->Config.MinPoolSize = 1;
+        ThreadSafePool->Config.MaxPoolSize = 2;
+        ThreadSafePool->Config.InitialPoolSize = 0;
+        ThreadSafePool->InitializePool();
+        
+        int32 SurplusNotifications = 0;
+        ThreadSafePool->OnDestroyQueued.BindLambda([&SurplusNotifications](UGWIZObjectPool*) { ++SurplusNotifications; });
+        
+        TArray<UObject*> ConcurrentObjects;
+        ThreadSafePool->GetObjects(UGWIZPoolingTestRunner::StaticClass(), 4, ConcurrentObjects);
+        ThreadSafePool->ReturnObjects(ConcurrentObjects);
+        UE_LOG(LogTemp, Log, TEXT("Thread-safe surplus queued: %d (expected 2), available: %d (expected 2), notifications: %d (expected 1)"),
+               ThreadSafePool->GetPendingDestroyCount(), ThreadSafePool->GetCurrentPoolSize(), SurplusNotifications);
+        
+        const int32 SurplusDestroyed = ThreadSafePool->ProcessPendingDestroy(TNumericLimits<double>::Max());
+        UE_LOG(LogTemp, Log, TEXT("Thread-safe surplus destroyed: %d (expected 2), pending: %d"),
+               SurplusDestroyed, ThreadSafePool->GetPendingDestroyCount());
+        
+        ThreadSafePool->OnDestroyQueued.Unbind();
+        ThreadSafePool->ClearPool();
+    }
+    
+    static void TestLifetimeHistogram()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Lifetime Histogram..."));
+        
+        // 1 ms to 100 ms in 1 ms steps: percentiles land within one bucket (25%) of the exact values
+        FGWIZLifetimeHistogram Histogram;
+        for (int32 i = 1; i <= 100; ++i)
+        {
+            Histogram.Add(i * 0.001);
+        }
+        const double P50 = Histogram.GetPercentile(0.50);
+        const double P99 = Histogram.GetPercentile(0.99);
+        UE_LOG(LogTemp, Log, TEXT("Mean: %.4f s (expected 0.0505)"), Histogram.GetMean());
+        UE_LOG(LogTemp, Log, TEXT("p50 within bucket error: %s (%.4f s)"), FMath::IsNearlyEqual(P50, 0.050, 0.050 * 0.25) ? TEXT("Yes") : TEXT("No"), P50);
+        UE_LOG(LogTemp, Log, TEXT("p99 within bucket error: %s (%.4f s)"), FMath::IsNearlyEqual(P99, 0.099, 0.099 * 0.25) ? TEXT("Yes") : TEXT("No"), P99);
+        
+        // Pools time each checkout and report the oldest one still out
+        UGWIZObjectPool* TestPool = NewObject<UGWIZObjectPool>();
+        TestPool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        TestPool->InitializePool();
+        
+        UObject* Held = TestPool->GetFromPool();
+        UObject* Returned = TestPool->GetFromPool();
+        FPlatformProcess::Sleep(0.01f);
+        TestPool->ReturnToPool(Returned);
+        
+        const FGWIZPoolStatistics Stats = TestPool->GetStatistics();
+        UE_LOG(LogTemp, Log, TEXT("Lifetime recorded: %s (p50 %.4f s)"), Stats.LifetimeP50 > 0.0f ? TEXT("Yes") : TEXT("No"), Stats.LifetimeP50);
+        UE_LOG(LogTemp, Log, TEXT("Oldest outstanding tracked: %s (%.4f s)"), Stats.OldestOutstandingAge >= 0.01f ? TEXT("Yes") : TEXT("No"), Stats.OldestOutstandingAge);
+        
+        TestPool->ReturnToPool(Held);
+        TestPool->ClearPool();
+    }
+    
+    static void TestMemoryAccounting()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Memory Accounting..."));
+        
+        UGWIZObjectPool* TestPool = NewObject<UGWIZObjectPool>();
+        TestPool->SetPooledObjectClass(UGWIZPoolingTestRunner::StaticClass());
+        TestPool->Config.InitialPoolSize = 4;
+        TestPool->InitializePool();
+        
+        // Resource-size reporting counts at least the object itself, so four objects are at least four structures
+        const int64 MinimumExpected = 4 * static_cast<int64>(UGWIZPoolingTestRunner::StaticClass()->GetStructureSize());
+        const int64 MemoryUsage = TestPool->GetMemoryUsage();
+        UE_LOG(LogTemp, Log, TEXT("Memory measured: %s (%lld bytes, at least %lld)"), MemoryUsage >= MinimumExpected ? TEXT("Yes") : TEXT("No"), MemoryUsage, MinimumExpected);
+        
+        // Measurements are only refreshed once they are older than the configured interval
+        const double Now = FPlatformTime::Seconds();
+        const bool bEarlyRefresh = TestPool->RefreshMemoryMeasurement(Now);
+        const bool bLateRefresh = TestPool->RefreshMemoryMeasurement(Now + TestPool->Config.MemoryRefreshIntervalSeconds + 1.0);
+        UE_LOG(LogTemp, Log, TEXT("Refresh respects interval: %s"), (!bEarlyRefresh && bLateRefresh) ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("Memory stable after refresh: %s"), TestPool->GetMemoryUsage() == MemoryUsage ? TEXT("Yes") : TEXT("No"));
+        
+        TestPool->ClearPool();
+        UE_LOG(LogTemp, Log, TEXT("Memory released with objects: %s"), TestPool->GetMemoryUsage() == 0 ? TEXT("Yes") : TEXT("No"));
+    }
+    
+    static void TestMemoryBudgets()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Memory Budgets..."));
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create test world"));
+            return;
+        }
+        
+        TestWorld->InitWorld();
+        
+        AGWIZPoolingManager* Manager = TestWorld->SpawnActor<AGWIZPoolingManager>();
+        if (!Manager)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to spawn pooling manager"));
+            TestWorld->DestroyWorld(false);
+            return;
+        }
+        
+        // A low-priority effects pool and a high-priority weapons pool, ten idle objects each
+        FGWIZPoolConfig LowConfig;
+        LowConfig.MinPoolSize = 1;
+        LowConfig.InitialPoolSize = 10;
+        LowConfig.Priority = 1;
+        LowConfig.Category = TEXT("Effects");
+        Manager->ConfigurePool(UGWIZPoolingTestRunner::StaticClass(), LowConfig);
+        UGWIZObjectPool* LowPool = Manager->GetPool(UGWIZPoolingTestRunner::StaticClass());
+        LowPool->InitializePool();
+        
+        FGWIZPoolConfig HighConfig;
+        HighConfig.MinPoolSize = 1;
+        HighConfig.InitialPoolSize = 6;
+        HighConfig.Priority = 9;
+        HighConfig.Category = TEXT("Weapons");
+        Manager->ConfigurePool(UGWIZPoolableTestObject::StaticClass(), HighConfig);
+        UGWIZObjectPool* HighPool = Manager->GetPool(UGWIZPoolableTestObject::StaticClass());
+        HighPool->InitializePool();
+        HighPool->PreWarmPool(10);
+        
+        // A category budget only evicts from its own category
+        Manager->CategoryMemoryBudgets.Add(TEXT("Effects"), 1);
+        const int64 CategoryFreed = Manager->EnforceMemoryBudgets();
+        UE_LOG(LogTemp, Log, TEXT("Category budget: freed %lld bytes, effects idle %d (expected 1), weapons idle %d (expected 10)"),
+               CategoryFreed, LowPool->GetCurrentPoolSize(), HighPool->GetCurrentPoolSize());
+        
+        // An impossible global budget still leaves the protected pool its warm set
+        Manager->CategoryMemoryBudgets.Empty();
+        Manager->MemoryBudgetBytes = 1;
+        Manager->EnforceMemoryBudgets();
+        UE_LOG(LogTemp, Log, TEXT("Global budget: effects idle %d (expected 1), weapons idle %d (expected 6)"),
+               LowPool->GetCurrentPoolSize(), HighPool->GetCurrentPoolSize());
+        
+        Manager->Destroy();
+        TestWorld->DestroyWorld(false);
+    }
+    
+    static void TestUsageProfiles()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Usage Profiles..."));
+        
+        // 95 quiet samples at 2 in use and a 5-sample burst at 40: p95 stays at the quiet level
+        FGWIZConcurrencyHistogram Usage;
+        for (int32 i = 0; i < 95; ++i)
+        {
+            Usage.Add(2);
+        }
+        for (int32 i = 0; i < 5; ++i)
+        {
+            Usage.Add(40);
+        }
+        UE_LOG(LogTemp, Log, TEXT("Peak: %d (expected 40), p95: %d (expected 2), p96: %d (expected 40)"),
+               Usage.Peak, Usage.GetPercentile(0.95), Usage.GetPercentile(0.96));
+        
+        // The first visit is taken as is; later visits average p95 and let a lower peak decay halfway
+        FGWIZPoolUsageProfile Profile;
+        Profile.Merge(Usage.Peak, Usage.GetPercentile(0.95));
+        Profile.Merge(20, 6);
+        UE_LOG(LogTemp, Log, TEXT("Learned peak: %d (expected 30), p95: %d (expected 4), sessions: %d (expected 2)"),
+               Profile.PeakConcurrentUsage, Profile.P95ConcurrentUsage, Profile.SessionCount);
+        
+        // A higher peak replaces the learned one outright
+        Profile.Merge(50, 4);
+        UE_LOG(LogTemp, Log, TEXT("Learned peak after spike: %d (expected 50)"), Profile.PeakConcurrentUsage);
+    }
+    
+    static void TestPoolResolution()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Pool Resolution..."));
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create test world"));
+            return;
+        }
+        
+        TestWorld->InitWorld();
+        
+        AGWIZPoolingManager* Manager = TestWorld->SpawnActor<AGWIZPoolingManager>();
+        if (!Manager)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to spawn pooling manager"));
+            TestWorld->DestroyWorld(false);
+            return;
+        }
+        
+        // A subclass resolves to its parent's pool, and the second lookup comes from the cache
+        UGWIZObjectPool* ParentPool = Manager->GetPool(UGWIZPoolableTestObject::StaticClass());
+        UE_LOG(LogTemp, Log, TEXT("Subclass resolves to parent pool: %s"),
+               Manager->GetPoolForClass(UGWIZNativeHookTestObject::StaticClass()) == ParentPool ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("Cached resolution matches: %s"),
+               Manager->GetPoolForClass(UGWIZNativeHookTestObject::StaticClass()) == ParentPool ? TEXT("Yes") : TEXT("No"));
+        
+        // Creating a pool for the subclass invalidates the cached resolution
+        UGWIZObjectPool* SubclassPool = Manager->GetPool(UGWIZNativeHookTestObject::StaticClass());
+        UE_LOG(LogTemp, Log, TEXT("Resolution updated after pool creation: %s"),
+               Manager->GetPoolForClass(UGWIZNativeHookTestObject::StaticClass()) == SubclassPool ? TEXT("Yes") : TEXT("No"));
+        
+        // Pooled objects point back at their pool, so returns skip the class lookup
+        UObject* Object = Manager->GetPooledObject(UGWIZNativeHookTestObject::StaticClass());
+        UE_LOG(LogTemp, Log, TEXT("Back-pointer to owning pool: %s"), UGWIZObjectPool::GetOwningPool(Object) == SubclassPool ? TEXT("Yes") : TEXT("No"));
+        Manager->ReturnPooledObject(Object);
+        UE_LOG(LogTemp, Log, TEXT("Returned through back-pointer: %s"), SubclassPool->IsObjectInUse(Object) ? TEXT("No") : TEXT("Yes"));
+        
+        Manager->Destroy();
+        TestWorld->DestroyWorld(false);
+    }
+    
+    static void TestPoolRegistry()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Pool Registry..."));
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create test world"));
+            return;
+        }
+        
+        TestWorld->InitWorld();
+        
+        AGWIZPoolingManager* Manager = TestWorld->SpawnActor<AGWIZPoolingManager>();
+        if (!Manager)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to spawn pooling manager"));
+            TestWorld->DestroyWorld(false);
+            return;
+        }
+        
+        UE_LOG(LogTemp, Log, TEXT("Empty registry: %d pools"), Manager->GetPoolCount());
+        
+        // Created pools are published to the registry and found again without creating another
+        UGWIZObjectPool* ParentPool = Manager->GetPool(UGWIZPoolableTestObject::StaticClass());
+        UE_LOG(LogTemp, Log, TEXT("Registered pool found: %s"), Manager->GetPool(UGWIZPoolableTestObject::StaticClass()) == ParentPool ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("Pool count after creation: %d (expected 1), all pools: %d"), Manager->GetPoolCount(), Manager->GetAllPools().Num());
+        
+        // Readers racing to resolve the same new class all see the same pool
+        std::atomic<int32> Mismatches(0);
+        ParallelFor(8, [&](int32)
+        {
+            for (int32 i = 0; i < 1000; ++i)
+            {
+                if (Manager->GetPoolForClass(UGWIZNativeHookTestObject::StaticClass()) != ParentPool)
+                {
+                    Mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+        UE_LOG(LogTemp, Log, TEXT("Concurrent resolution mismatches: %d (expected 0)"), Mismatches.load());
+        
+        // Clearing empties the registry
+        Manager->ClearAllPools();
+        UE_LOG(LogTemp, Log, TEXT("Pool count after clear: %d (expected 0)"), Manager->GetPoolCount());
+        UE_LOG(LogTemp, Log, TEXT("Stale resolution dropped: %s"),
+               Manager->GetPoolForClass(UGWIZNativeHookTestObject::StaticClass()) == nullptr ? TEXT("Yes") : TEXT("No"));
+        
+        Manager->Destroy();
+        TestWorld->DestroyWorld(false);
+    }
+    
+    static void TestPerWorldManagers()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Per-World Managers..."));
+        
+        UWorld* WorldA = UWorld::CreateWorld(EWorldType::Game, false);
+        UWorld* WorldB = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!WorldA || !WorldB)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create test worlds"));
+            return;
+        }
+        
+        WorldA->InitWorld();
+        WorldB->InitWorld();
+        
+        // A manager spawned into a world is the one the static API returns for it
+        AGWIZPoolingManager* PlacedManager = WorldA->SpawnActor<AGWIZPoolingManager>();
+        AGWIZPoolingManager* ManagerA = AGWIZPoolingManager::GetPoolingManager(WorldA);
+        UE_LOG(LogTemp, Log, TEXT("Placed manager registered: %s"), (PlacedManager != nullptr && ManagerA == PlacedManager) ? TEXT("Yes") : TEXT("No"));
+        
+        // A world without one gets its own on first use, and keeps it
+        AGWIZPoolingManager* ManagerB = AGWIZPoolingManager::GetPoolingManager(WorldB);
+        UE_LOG(LogTemp, Log, TEXT("Spawned on demand: %s"), ManagerB != nullptr ? TEXT("Yes") : TEXT("No"));
+        UE_LOG(LogTemp, Log, TEXT("One manager per world: %s"), (ManagerB != ManagerA && AGWIZPoolingManager::GetPoolingManager(WorldB) == ManagerB) ? TEXT("Yes") : TEXT("No"));
+        
+        // Pools are not shared between worlds
+        UGWIZObjectPool* PoolA = ManagerA ? ManagerA->GetPool(UGWIZPoolingTestRunner::StaticClass()) : nullptr;
+        UGWIZObjectPool* PoolB = ManagerB ? ManagerB->GetPool(UGWIZPoolingTestRunner::StaticClass()) : nullptr;
+        UE_LOG(LogTemp, Log, TEXT("Pools isolated between worlds: %s"), (PoolA != nullptr && PoolB != nullptr && PoolA != PoolB) ? TEXT("Yes") : TEXT("No"));
+        
+        WorldA->DestroyWorld(false);
+        WorldB->DestroyWorld(false);
+    }
+    
+    static void TestPoolIndex()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Pool Index..."));
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create test world"));
+            return;
+        }
+        
+        TestWorld->InitWorld();
+        
+        AGWIZPoolingManager* Manager = AGWIZPoolingManager::GetPoolingManager(TestWorld);
+        if (!Manager)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to get pooling manager"));
+            TestWorld->DestroyWorld(false);
+            return;
+        }
+        
+        FGWIZPoolConfig Config;
+        Config.Category = TEXT("Projectiles");
+        Config.Priority = 7;
+        Manager->ConfigurePool(UGWIZPoolingTestRunner::StaticClass(), Config);
+        Manager->ConfigurePool(UGWIZPoolableTestObject::StaticClass(), Config);
+        
+        // Category names compare case-insensitively, like the strings they replace
+        UE_LOG(LogTemp, Log, TEXT("Pools in category: %d (expected 2), at priority 7: %d (expected 2)"),
+               Manager->GetPoolsInCategory(TEXT("projectiles")).Num(), Manager->GetPoolsAtPriority(7).Num());
+        
+        // Reconfiguring moves a pool between buckets
+        Config.Category = TEXT("Effects");
+        Config.Priority = 2;
+        Manager->ConfigurePool(UGWIZPoolableTestObject::StaticClass(), Config);
+        UE_LOG(LogTemp, Log, TEXT("After reconfigure: projectiles %d (expected 1), effects %d (expected 1), priority 7 %d (expected 1), priority 2 %d (expected 1)"),
+               Manager->GetPoolsInCategory(TEXT("Projectiles")).Num(), Manager->GetPoolsInCategory(TEXT("Effects")).Num(),
+               Manager->GetPoolsAtPriority(7).Num(), Manager->GetPoolsAtPriority(2).Num());
+        
+        // The Blueprint queries copy from the same buckets
+        UE_LOG(LogTemp, Log, TEXT("Blueprint query matches index: %s"),
+               Manager->GetPoolsByCategory(TEXT("Effects")).Num() == 1 ? TEXT("Yes") : TEXT("No"));
+        
+        Manager->ClearAllPools();
+        UE_LOG(LogTemp, Log, TEXT("Index cleared with pools: %s"), Manager->GetPoolsAtPriority(7).Num() == 0 ? TEXT("Yes") : TEXT("No"));
+        
+        TestWorld->DestroyWorld(false);
+    }
+    
+    static void TestMaintenanceScheduler()
+    {
+        UE_LOG(LogTemp, Log, TEXT("Testing Maintenance Scheduler..."));
+        
+        UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+        if (!TestWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create test world"));
+            return;
+        }
+        
+        TestWorld->InitWorld();
+        
+        AGWIZPoolingManager* Manager = AGWIZPoolingManager::GetPoolingManager(TestWorld);
+        if (!Manager)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to get pooling manager"));
+            TestWorld->DestroyWorld(false);
+            return;
+        }
+        
+        // No time budget and a long interval: every call visits exactly one pool, and each pool once
+        Manager->bEnableAdaptiveSizing = false;
+        Manager->MaintenanceFrameBudgetUs = 0.0f;
+        Manager->MaintenanceIntervalSeconds = 60.0f;
+        Manager->AutoCleanupIdleSeconds = 0.0f;
+        
+        FGWIZPoolConfig Config;
+        Config.MinPoolSize = 1;
+        Config.InitialPoolSize = 8;
+        Manager->ConfigurePool(UGWIZPoolingTestRunner::StaticClass(), Config);
+        Manager->ConfigurePool(UGWIZPoolableTestObject::StaticClass(), Config);
+        Manager->ConfigurePool(UGWIZNativeHookTestObject::StaticClass(), Config);
+        
+        UGWIZObjectPool* IdlePool = Manager->GetPool(UGWIZPoolingTestRunner::StaticClass());
+        IdlePool->InitializePool();
+        
+        int32 Visits[4];
+        for (int32& VisitCount : Visits)
+        {
+            VisitCount = Manager->RunMaintenance();
+        }
+        UE_LOG(LogTemp, Log, TEXT("Visits per call: %d %d %d %d (expected 1 1 1 0)"), Visits[0], Visits[1], Visits[2], Visits[3]);
+        
+        // Auto cleanup trimmed the idle pool to its minimum on its visit
+        UE_LOG(LogTemp, Log, TEXT("Idle pool trimmed: %d idle (expected 1)"), IdlePool->GetCurrentPoolSize());
+        
+        // A pool whose objects all came back before its visit was still used, and a protected pool keeps its warm set
+        UGWIZObjectPool* BusyPool = Manager->GetPool(UGWIZPoolableTestObject::StaticClass());
+        BusyPool->InitializePool();
+        BusyPool->ReturnObject(BusyPool->GetFromPool());
+        
+        Config.Priority = Manager->EvictionProtectedPriority;
+        Manager->ConfigurePool(UGWIZNativeHookTestObject::StaticClass(), Config);
+        UGWIZObjectPool* ProtectedPool = Manager->GetPool(UGWIZNativeHookTestObject::StaticClass());
+        ProtectedPool->InitializePool();
+        
+        Manager->MaintenanceIntervalSeconds = 0.0f;
+        for (int32 i = 0; i < 3; ++i)
+        {
+            Manager->RunMaintenance();
+        }
+        UE_LOG(LogTemp, Log, TEXT("Recently used pool kept: %d idle (expected 8)"), BusyPool->GetCurrentPoolSize());
+        UE_LOG(LogTemp, Log, TEXT("Protected pool kept warm set: %d idle (expected 8)"), ProtectedPool->GetCurrentPoolSize());
+        
+        for (int32 i = 0; i < 3; ++i)
+        {
+            Manager->RunMaintenance();
+        }
+        UE_LOG(LogTemp, Log, TEXT("Pool trimmed once unused: %d idle (expected 1)"), BusyPool->GetCurrentPoolSize());
+        
+        TestWorld->DestroyWorld(false);
+    }
 };
 
 // Simple test runner that can be called from anywhere
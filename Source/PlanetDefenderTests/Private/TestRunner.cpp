@@ -6,6 +6,7 @@
 #include "Engine/Engine.h"
 #include "PoolingSystem/GWIZObjectPool.h"
 #include "SimplePoolingTests.h"
+#include "PoolingBenchmarks.h"
 
 /**
  * Simple test runner for GWIZ Pooling System.
@@ -23,6 +24,11 @@ void UGWIZPoolingTestRunner::RunAllPoolingTests()
     ::RunAllPoolingTests();
 }
 
+void UGWIZPoolingTestRunner::RunPoolingBenchmarks()
+{
+    ::RunPoolingBenchmarks();
+}
+
 // Simple test function that can be called from anywhere
 void RunQuickPoolingTest()
 {
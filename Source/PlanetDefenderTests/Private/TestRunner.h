@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
+#include "PoolingSystem/IGWIZPoolable.h"
 #include "TestRunner.generated.h"
 
 /**
@@ -25,6 +26,53 @@ public:
     /** Run all comprehensive pooling tests */
     UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling Tests", CallInEditor)
     static void RunAllPoolingTests();
+
+    /** Run pooling performance benchmarks */
+    UFUNCTION(BlueprintCallable, Category = "GWIZ Pooling Tests", CallInEditor)
+    static void RunPoolingBenchmarks();
+};
+
+/**
+ * Minimal poolable object with a native IGWIZPoolable implementation.
+ * Counts lifecycle callbacks so tests can check they run exactly once per transition.
+ */
+UCLASS()
+class PLANETDEFENDERTESTS_API UGWIZPoolableTestObject : public UObject, public IGWIZPoolable
+{
+    GENERATED_BODY()
+
+public:
+    /** Number of OnPooled calls received */
+    UPROPERTY()
+    int32 PooledCount = 0;
+
+    /** Number of OnUnpooled calls received */
+    UPROPERTY()
+    int32 UnpooledCount = 0;
+
+    virtual void OnPooled_Implementation() override { ++PooledCount; }
+    virtual void OnUnpooled_Implementation() override { ++UnpooledCount; }
+    virtual bool IsPooled_Implementation() const override { return UnpooledCount >= PooledCount; }
+};
+
+/**
+ * Poolable object that also declares native hooks, so TGWIZTypedPool binds them at compile time.
+ * Interface counts only move when the object goes through the untyped pool API.
+ */
+UCLASS()
+class PLANETDEFENDERTESTS_API UGWIZNativeHookTestObject : public UGWIZPoolableTestObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Number of NativeOnPooled calls received */
+    int32 NativePooledCount = 0;
+
+    /** Number of NativeOnUnpooled calls received */
+    int32 NativeUnpooledCount = 0;
+
+    void NativeOnPooled() { ++NativePooledCount; }
+    void NativeOnUnpooled() { ++NativeUnpooledCount; }
 };
 
 /** Run a quick test of basic pooling functionality */